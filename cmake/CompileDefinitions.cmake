@@ -24,6 +24,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_DEFAULT_FONT)
     define_if("raylib" SUPPORT_SCREEN_CAPTURE)
     define_if("raylib" SUPPORT_GIF_RECORDING)
+    define_if("raylib" SUPPORT_ASYNC_SCREEN_CAPTURE)
     define_if("raylib" SUPPORT_BUSY_WAIT_LOOP)
     define_if("raylib" SUPPORT_EVENTS_WAITING)
     define_if("raylib" SUPPORT_WINMM_HIGHRES_TIMER)
@@ -32,6 +33,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_IMAGE_EXPORT)
     define_if("raylib" SUPPORT_IMAGE_GENERATION)
     define_if("raylib" SUPPORT_IMAGE_MANIPULATION)
+    define_if("raylib" SUPPORT_TEXTURE_IMPORT_CACHE)
     define_if("raylib" SUPPORT_FILEFORMAT_PNG)
     define_if("raylib" SUPPORT_FILEFORMAT_DDS)
     define_if("raylib" SUPPORT_FILEFORMAT_HDR)
@@ -48,6 +50,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_PVR)
     define_if("raylib" SUPPORT_FILEFORMAT_FNT)
     define_if("raylib" SUPPORT_FILEFORMAT_TTF)
+    define_if("raylib" SUPPORT_FONT_GLYPH_CACHE)
     define_if("raylib" SUPPORT_TEXT_MANIPULATION)
     define_if("raylib" SUPPORT_MESH_GENERATION)
     define_if("raylib" SUPPORT_FILEFORMAT_OBJ)
@@ -63,6 +66,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_FLAC)
     define_if("raylib" SUPPORT_STANDARD_FILEIO)
     define_if("raylib" SUPPORT_TRACELOG)
+    define_if("raylib" SUPPORT_WORKER_THREADS)
 
     if (UNIX AND NOT APPLE)
         target_compile_definitions("raylib" PUBLIC "MAX_FILEPATH_LENGTH=4096")
@@ -79,6 +83,7 @@ if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC "STORAGE_DATA_FILE=\"storage.data\"")
     target_compile_definitions("raylib" PUBLIC "MAX_CHAR_PRESSED_QUEUE=16")
     target_compile_definitions("raylib" PUBLIC "MAX_DECOMPRESSION_SIZE=64")
+    target_compile_definitions("raylib" PUBLIC "MAX_SCREEN_CAPTURES=4")
     
     if (${GRAPHICS} MATCHES "GRAPHICS_API_OPENGL_33" OR ${GRAPHICS} MATCHES "GRAPHICS_API_OPENGL_11")
         target_compile_definitions("raylib" PUBLIC "DEFAULT_BATCH_BUFFER_ELEMENTS=8192")
@@ -110,6 +115,7 @@ if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC "DEFAULT_AUDIO_BUFFER_SIZE=4096")
 
     target_compile_definitions("raylib" PUBLIC "MAX_TRACELOG_MSG_LENGTH=128")
+    target_compile_definitions("raylib" PUBLIC "MAX_WORKER_THREADS=4")
     target_compile_definitions("raylib" PUBLIC "MAX_UWP_MESSAGES=512")
 endif ()
 
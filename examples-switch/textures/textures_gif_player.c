@@ -28,22 +28,16 @@ int main(void)
 
     InitWindow(screenWidth, screenHeight, "raylib [textures] example - gif playing");
 
-    int animFrames = 0;
-
-    // Load all GIF animation frames into a single Image
+    // Load GIF animation stream, only current frame is decoded and kept in memory
     // NOTE: GIF data is always loaded as RGBA (32bit) by default
-    // NOTE: Frames are just appended one after another in image.data memory
-    Image imScarfyAnim = LoadImageAnim("resources/scarfy_run.gif", &animFrames);
+    AnimImage scarfyAnim = LoadAnimImage("resources/scarfy_run.gif");
 
-    // Load texture from image
+    // Load texture from current frame image
     // NOTE: We will update this texture when required with next frame data
     // WARNING: It's not recommended to use this technique for sprites animation,
     // use spritesheets instead, like illustrated in textures_sprite_anim example
-    Texture2D texScarfyAnim = LoadTextureFromImage(imScarfyAnim);
-
-    unsigned int nextFrameDataOffset = 0;  // Current byte offset to next frame in image.data
+    Texture2D texScarfyAnim = LoadTextureFromImage(scarfyAnim.image);
 
-    int currentAnimFrame = 0;       // Current animation frame to load and draw
     int frameDelay = 8;             // Frame delay to switch between animation frames
     int frameCounter = 0;           // General frames counter
 
@@ -58,17 +52,13 @@ int main(void)
         frameCounter++;
         if (frameCounter >= frameDelay)
         {
-            // Move to next frame
-            // NOTE: If final frame is reached we return to first frame
-            currentAnimFrame++;
-            if (currentAnimFrame >= animFrames) currentAnimFrame = 0;
-
-            // Get memory offset position for next frame data in image.data
-            nextFrameDataOffset = imScarfyAnim.width*imScarfyAnim.height*4*currentAnimFrame;
+            // Decode next frame
+            // NOTE: If final frame is reached we return to first frame (looping enabled by default)
+            UpdateAnimImage(&scarfyAnim);
 
             // Update GPU texture data with next frame image data
             // WARNING: Data size (frame size) and pixel format must match already created texture
-            UpdateTexture(texScarfyAnim, ((unsigned char *)imScarfyAnim.data) + nextFrameDataOffset);
+            UpdateTexture(texScarfyAnim, scarfyAnim.image.data);
 
             frameCounter = 0;
         }
@@ -87,9 +77,9 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            DrawText(TextFormat("TOTAL GIF FRAMES:  %02i", animFrames), 50, 30, 20, LIGHTGRAY);
-            DrawText(TextFormat("CURRENT FRAME: %02i", currentAnimFrame), 50, 60, 20, GRAY);
-            DrawText(TextFormat("CURRENT FRAME IMAGE.DATA OFFSET: %02i", nextFrameDataOffset), 50, 90, 20, GRAY);
+            DrawText(TextFormat("TOTAL GIF FRAMES:  %02i", scarfyAnim.frameCount), 50, 30, 20, LIGHTGRAY);
+            DrawText(TextFormat("CURRENT FRAME: %02i", scarfyAnim.currentFrame), 50, 60, 20, GRAY);
+            DrawText(TextFormat("CURRENT FRAME FILE DELAY: %i ms", scarfyAnim.frameDelay), 50, 90, 20, GRAY);
 
             DrawText("FRAMES DELAY: ", 100, 305, 10, DARKGRAY);
             DrawText(TextFormat("%02i frames", frameDelay), 620, 305, 10, DARKGRAY);
@@ -112,7 +102,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadTexture(texScarfyAnim);   // Unload texture
-    UnloadImage(imScarfyAnim);      // Unload image (contains all frames)
+    UnloadAnimImage(scarfyAnim);    // Unload animation stream
 
     CloseWindow();                  // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -0,0 +1,146 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Text box chat log (word-wrapping)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MESSAGES_PER_FRAME      20          // Chat messages appended per frame, while filling log
+#define MAX_MESSAGES          5000          // Chat messages to append
+
+static const char *users[4] = { "ray", "santamaria", "guest", "bot" };
+static const char *messages[4] = {
+    "hello!",
+    "Text boxes wrap lines to a width, appended text only wraps the last paragraph again.",
+    "Lines are broken at spaces, a veryveryveryveryveryveryveryverylongword is broken at any character.",
+    "Alignment, line spacing and ellipsis are applied on drawing."
+};
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - text box chat log");
+
+    Rectangle container = { 25.0f, 25.0f, 500.0f, 360.0f };
+
+    // Chat log text box, lines wrapped to container width
+    TextBox chat = LoadTextBox(GetFontDefault(), "", 20.0f, 2.0f, container.width - 20.0f);
+    chat.lineSpacing = 1.25f;
+
+    // NOTE: Text is appended one byte per frame, a UTF-8 sequence truncated at text end ("é" bytes)
+    // is drawn as '?' until next byte completes it (save this code file as UTF-8)
+    const char *typewriter = "Typewriter effect: text box is appended one byte per frame, its last line grows and wraps (café).";
+    TextBox typed = LoadTextBox(GetFontDefault(), "", 10.0f, 1.0f, 220.0f);
+    typed.alignment = TEXT_ALIGN_CENTER;
+    int typedCount = 0;
+
+    int messageCount = 0;
+    double appendTime = 0.0;
+    double reflowTime = 0.0;
+    int visibleLines = (int)((container.height - 20.0f)/(chat.fontSize*chat.lineSpacing));
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Fill chat log, appended text is wrapped (previous messages lines are kept)
+        if (messageCount < MAX_MESSAGES)
+        {
+            double startTime = GetTime();
+
+            for (int i = 0; (i < MESSAGES_PER_FRAME) && (messageCount < MAX_MESSAGES); i++, messageCount++)
+            {
+                AppendTextBoxText(&chat, TextFormat("%s: %s\n", users[messageCount%4], messages[(messageCount/4 + messageCount)%4]));
+            }
+
+            appendTime = (GetTime() - startTime)*1000.0;
+
+            // Scroll to last lines while filling
+            chat.firstLine = chat.lineCount - visibleLines;
+        }
+
+        // Scroll chat log
+        chat.firstLine -= (int)(GetMouseWheelMove()*3.0f);
+        if (IsKeyDown(KEY_UP)) chat.firstLine--;
+        if (IsKeyDown(KEY_DOWN)) chat.firstLine++;
+        if (chat.firstLine > (chat.lineCount - visibleLines)) chat.firstLine = chat.lineCount - visibleLines;
+        if (chat.firstLine < 0) chat.firstLine = 0;
+
+        // Resize chat log, all lines are wrapped again
+        if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT))
+        {
+            container.width += IsKeyPressed(KEY_LEFT)? -50.0f : 50.0f;
+            if (container.width < 150.0f) container.width = 150.0f;
+            if (container.width > 500.0f) container.width = 500.0f;
+
+            double startTime = GetTime();
+            SetTextBoxWidth(&chat, container.width - 20.0f);
+            reflowTime = (GetTime() - startTime)*1000.0;
+        }
+
+        // Typewriter, one byte appended per frame
+        if (typewriter[typedCount] != '\0') AppendTextBoxText(&typed, TextSubtext(typewriter, typedCount++, 1));
+        else if (IsKeyPressed(KEY_SPACE))
+        {
+            SetTextBoxText(&typed, "");
+            typedCount = 0;
+        }
+
+        chat.maxLines = visibleLines;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawRectangleLinesEx(container, 3, MAROON);
+            DrawTextBox(chat, (Vector2){ container.x + 10.0f, container.y + 10.0f }, DARKGRAY);
+
+            // Typewriter text box, lines limited (ellipsis drawn if text continues)
+            typed.maxLines = 3;
+            DrawRectangleLines(550, 25, 230, 120, GRAY);
+            DrawTextBox(typed, (Vector2){ 555, 35 }, DARKBLUE);
+
+            DrawText(TextFormat("Messages: %i", messageCount), 550, 170, 20, DARKGRAY);
+            DrawText(TextFormat("Wrapped lines: %i", chat.lineCount), 550, 195, 20, DARKGRAY);
+            DrawText(TextFormat("Append: %.3f ms", appendTime), 550, 230, 20, DARKGREEN);
+            DrawText(TextFormat("Full reflow: %.3f ms", reflowTime), 550, 255, 20, MAROON);
+
+            DrawText("MOUSE WHEEL OR UP/DOWN TO SCROLL", 25, screenHeight - 50, 20, GRAY);
+            DrawText("LEFT/RIGHT TO RESIZE, SPACE TO RESTART TYPEWRITER", 25, screenHeight - 25, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextBox(chat);        // Unload text box data
+    UnloadTextBox(typed);
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
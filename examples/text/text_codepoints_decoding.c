@@ -0,0 +1,143 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - UTF-8 codepoints decoding benchmark
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define CORPUS_SIZE         64*1024     // Text corpus size in bytes
+#define DECODE_ITERATIONS        20     // Decoding iterations per frame and corpus
+
+// Text samples to build corpora, must be UTF-8 (save this code file as UTF-8)
+static const char *asciiSample = "The quick brown fox jumps over the lazy dog, 0123456789!\n";
+static const char *cjkSample = "いろはにほへと　ちりぬるを　わかよたれそ　つねならむ\n";
+
+// Build text corpus repeating a sample, until corpus size
+static char *LoadCorpus(const char *sample)
+{
+    char *corpus = (char *)malloc(CORPUS_SIZE + 1);
+    int sampleLength = TextLength(sample);
+    int length = 0;
+
+    while ((length + sampleLength) <= CORPUS_SIZE) length += TextCopy(corpus + length, sample);
+
+    return corpus;
+}
+
+// Count codepoints one by one, reference decoding loop (per byte logic)
+static int CountCodepointsNext(const char *text)
+{
+    int count = 0;
+
+    for (int i = 0; text[i] != '\0'; count++)
+    {
+        int codepointSize = 0;
+        GetCodepointNext(&text[i], &codepointSize);
+        i += codepointSize;
+    }
+
+    return count;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - UTF-8 codepoints decoding benchmark");
+
+    // Load font with ASCII and CJK glyphs, required to measure both corpora
+    int codepointCount = 0;
+    int *codepoints = LoadCodepoints(TextFormat("%s%s", asciiSample, cjkSample), &codepointCount);
+    Font font = LoadFontEx("resources/DotGothic16-Regular.ttf", 32, codepoints, codepointCount);
+    UnloadCodepoints(codepoints);
+
+    const char *names[2] = { "ASCII", "CJK" };
+    char *corpora[2] = { LoadCorpus(asciiSample), LoadCorpus(cjkSample) };
+
+    // Decoding times (ms), smoothed: reference loop, GetCodepointCount(), LoadCodepoints(), MeasureTextEx()
+    double times[2][4] = { 0 };
+    int counts[2] = { 0 };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        for (int c = 0; c < 2; c++)
+        {
+            double startTime = GetTime();
+            for (int i = 0; i < DECODE_ITERATIONS; i++) counts[c] = CountCodepointsNext(corpora[c]);
+            times[c][0] = times[c][0]*0.9 + (GetTime() - startTime)*1000.0*0.1;
+
+            // NOTE: ASCII bytes are checked and decoded in blocks
+            startTime = GetTime();
+            for (int i = 0; i < DECODE_ITERATIONS; i++) counts[c] = GetCodepointCount(corpora[c]);
+            times[c][1] = times[c][1]*0.9 + (GetTime() - startTime)*1000.0*0.1;
+
+            startTime = GetTime();
+            for (int i = 0; i < DECODE_ITERATIONS; i++) UnloadCodepoints(LoadCodepoints(corpora[c], &counts[c]));
+            times[c][2] = times[c][2]*0.9 + (GetTime() - startTime)*1000.0*0.1;
+
+            startTime = GetTime();
+            for (int i = 0; i < DECODE_ITERATIONS; i++) MeasureTextEx(font, corpora[c], 32, 0);
+            times[c][3] = times[c][3]*0.9 + (GetTime() - startTime)*1000.0*0.1;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i x decoding of %i KB text corpora", DECODE_ITERATIONS, CORPUS_SIZE/1024), 40, 30, 20, DARKGRAY);
+
+            for (int c = 0; c < 2; c++)
+            {
+                int posY = 80 + c*150;
+
+                DrawText(TextFormat("%s corpus: %i codepoints", names[c], counts[c]), 40, posY, 20, MAROON);
+                DrawText(TextFormat("GetCodepointNext() loop: %.3f ms", times[c][0]), 60, posY + 30, 20, GRAY);
+                DrawText(TextFormat("GetCodepointCount(): %.3f ms", times[c][1]), 60, posY + 55, 20, DARKGREEN);
+                DrawText(TextFormat("LoadCodepoints(): %.3f ms", times[c][2]), 60, posY + 80, 20, DARKGREEN);
+                DrawText(TextFormat("MeasureTextEx(): %.3f ms", times[c][3]), 60, posY + 105, 20, DARKGREEN);
+            }
+
+            DrawTextEx(font, "quick fox いろは", (Vector2){ 540, 80 }, 32, 0, DARKBLUE);  // Only sample glyphs loaded
+
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(corpora[0]);
+    free(corpora[1]);
+    UnloadFont(font);       // Unload font
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
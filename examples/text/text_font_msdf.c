@@ -0,0 +1,130 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - MSDF fonts rendering
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - MSDF fonts rendering");
+
+    const char msg[50] = "Multi-channel SDF: sharp corners";
+
+    // Loading file to memory
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData("resources/anonymous_pro_bold.ttf", &fileSize);
+
+    // Default font generation from TTF font, for comparison
+    Font fontDefault = LoadFontFromMemory(".ttf", fileData, fileSize, 32, 0, 95);
+
+    // MSDF font generation from TTF font, glyphs are generated on worker threads
+    // NOTE: One small atlas (32 pixels base size) renders sharply at any size
+    Font fontMsdf = { 0 };
+    fontMsdf.baseSize = 32;
+    fontMsdf.glyphCount = 95;
+    fontMsdf.glyphs = LoadFontData(fileData, fileSize, 32, 0, 0, FONT_MSDF);
+
+    // Parameters > glyphs count: 95, font size: 32, glyphs padding in image: 2 px, pack method: 0 (default)
+    // NOTE: Padding is required, bilinear filtering must not mix MSDF channels of neighbour glyphs
+    Image atlas = GenImageFontAtlas(fontMsdf.glyphs, &fontMsdf.recs, 95, 32, 2, 0);
+    fontMsdf.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
+    UnloadFileData(fileData);      // Free memory from loaded file
+
+    // Load MSDF required shader (we use default vertex shader)
+    Shader shader = LoadFontShaderMSDF();
+    SetTextureFilter(fontMsdf.texture, TEXTURE_FILTER_BILINEAR);    // Required for MSDF font
+
+    float fontSize = 32.0f;
+    Vector2 textSize = { 0.0f, 0.0f };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        fontSize += GetMouseWheelMove()*8.0f;
+
+        if (IsKeyDown(KEY_UP)) fontSize += 1.0f;
+        if (IsKeyDown(KEY_DOWN)) fontSize -= 1.0f;
+
+        if (fontSize < 8.0f) fontSize = 8.0f;
+        if (fontSize > 200.0f) fontSize = 200.0f;
+
+        textSize = MeasureTextEx(fontMsdf, msg, fontSize, 0);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (IsKeyDown(KEY_SPACE))
+            {
+                // Draw default font, scaled from 32 pixels atlas
+                DrawTextEx(fontDefault, msg, (Vector2){ 20, 160 - textSize.y/2 }, fontSize, 0, BLACK);
+                DrawText("DEFAULT FONT", 315, 40, 20, RED);
+            }
+            else
+            {
+                BeginShaderMode(shader);    // Activate MSDF font shader
+                    DrawTextEx(fontMsdf, msg, (Vector2){ 20, 160 - textSize.y/2 }, fontSize, 0, BLACK);
+                EndShaderMode();            // Activate our default shader for next drawings
+
+                DrawText("MSDF FONT", 315, 40, 20, DARKGREEN);
+
+                // Same atlas drawn at multiple sizes
+                const float sizes[5] = { 8.0f, 16.0f, 24.0f, 48.0f, 96.0f };
+                float posX = 20.0f;
+
+                BeginShaderMode(shader);
+                    for (int i = 0; i < 5; i++)
+                    {
+                        DrawTextEx(fontMsdf, "Sharp", (Vector2){ posX, 350 - sizes[i] }, sizes[i], 0, DARKBLUE);
+                        posX += MeasureTextEx(fontMsdf, "Sharp", sizes[i], 0).x + 20;
+                    }
+                EndShaderMode();
+            }
+
+            DrawText(TextFormat("FONT SIZE: %02.02f", fontSize), GetScreenWidth() - 240, 20, 20, DARKGRAY);
+            DrawText("USE MOUSE WHEEL OR UP/DOWN TO SCALE", 20, screenHeight - 50, 20, GRAY);
+            DrawText("PRESS SPACE to USE DEFAULT FONT", 20, screenHeight - 25, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFont(fontDefault);    // Default font unloading
+    UnloadFont(fontMsdf);       // MSDF font unloading
+
+    UnloadShader(shader);       // Unload MSDF shader
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - SDF font loading benchmark
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define BENCHMARK_RUNS      2               // Number of benchmark runs (glyph counts)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - SDF font loading benchmark");
+
+    // Load font file data, glyphs are rasterized (SDF) by LoadFontData() on worker threads
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData("resources/DotGothic16-Regular.ttf", &fileSize);
+
+    const int glyphCounts[BENCHMARK_RUNS] = { 1000, 10000 };
+    double loadTimes[BENCHMARK_RUNS] = { 0 };
+    int benchmarkRun = 0;
+
+    // Codepoints to load: ASCII and CJK unified ideographs
+    int *codepoints = (int *)malloc(glyphCounts[BENCHMARK_RUNS - 1]*sizeof(int));
+    for (int i = 0; i < glyphCounts[BENCHMARK_RUNS - 1]; i++) codepoints[i] = (i < 95)? (32 + i) : (0x4e00 + i - 95);
+
+    Font fontSdf = { 0 };
+
+    // Load SDF required shader (we use default vertex shader)
+    Shader shader = LoadShader(0, TextFormat("resources/shaders/glsl%i/sdf.fs", GLSL_VERSION));
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Run one benchmark per frame, so progress is displayed while loading
+        if ((benchmarkRun < BENCHMARK_RUNS) && (GetFrameTime() > 0.0f))
+        {
+            double startTime = GetTime();
+            GlyphInfo *glyphs = LoadFontData(fileData, fileSize, 32, codepoints, glyphCounts[benchmarkRun], FONT_SDF);
+            loadTimes[benchmarkRun] = (GetTime() - startTime)*1000.0;
+
+            if (benchmarkRun == 0)
+            {
+                // Keep first font to draw it, atlas generated from SDF glyphs
+                fontSdf.baseSize = 32;
+                fontSdf.glyphCount = glyphCounts[0];
+                fontSdf.glyphs = glyphs;
+
+                Image atlas = GenImageFontAtlas(fontSdf.glyphs, &fontSdf.recs, fontSdf.glyphCount, 32, 0, 1);
+                fontSdf.texture = LoadTextureFromImage(atlas);
+                UnloadImage(atlas);
+
+                SetTextureFilter(fontSdf.texture, TEXTURE_FILTER_BILINEAR);
+            }
+            else UnloadFontData(glyphs, glyphCounts[benchmarkRun]);
+
+            benchmarkRun++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < BENCHMARK_RUNS; i++)
+            {
+                if (i < benchmarkRun) DrawText(TextFormat("LoadFontData() SDF, %i glyphs: %.1f ms", glyphCounts[i], loadTimes[i]), 40, 40 + 40*i, 20, DARKGREEN);
+                else DrawText(TextFormat("LoadFontData() SDF, %i glyphs: loading...", glyphCounts[i]), 40, 40 + 40*i, 20, MAROON);
+            }
+
+            if (fontSdf.texture.id > 0)
+            {
+                BeginShaderMode(shader);    // Activate SDF font shader
+                    DrawTextEx(fontSdf, "SDF glyphs: 一丁七万丈三上下", (Vector2){ 40, 200 }, 64, 0, DARKGRAY);
+                EndShaderMode();            // Activate our default shader for next drawings
+            }
+
+            DrawText("Glyphs rasterization runs on worker threads", 40, screenHeight - 40, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFont(fontSdf);        // Unload SDF font
+    UnloadShader(shader);       // Unload SDF shader
+    free(codepoints);
+    UnloadFileData(fileData);   // Unload font file data
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
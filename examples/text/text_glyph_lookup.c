@@ -0,0 +1,88 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Glyph lookup benchmark
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+// Text to be measured, must be UTF-8 (save this code file as UTF-8)
+static const char *text = "いろはにほへと　ちりぬるを\nわかよたれそ　つねならむ\nうゐのおくやま　けふこえて\nあさきゆめみし　ゑひもせす";
+
+#define MEASURE_ITERATIONS      2000        // Text measurements per frame
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - glyph lookup benchmark");
+
+    // Load BMFont with CJK glyphs, codepoint to glyph index lookup is built on loading
+    Font font = LoadFont("resources/noto_cjk.fnt");
+
+    // Same font without lookup, glyphs are searched linearly (fonts generated by user code)
+    Font fontLinear = font;
+    fontLinear.glyphLookup = 0;
+
+    double lookupTime = 0.0;
+    double linearTime = 0.0;
+    Vector2 textSize = { 0 };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        double startTime = GetTime();
+        for (int i = 0; i < MEASURE_ITERATIONS; i++) textSize = MeasureTextEx(font, text, (float)font.baseSize, 2);
+        lookupTime = lookupTime*0.9 + (GetTime() - startTime)*1000.0*0.1;
+
+        startTime = GetTime();
+        for (int i = 0; i < MEASURE_ITERATIONS; i++) textSize = MeasureTextEx(fontLinear, text, (float)font.baseSize, 2);
+        linearTime = linearTime*0.9 + (GetTime() - startTime)*1000.0*0.1;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawTextEx(font, text, (Vector2){ 40, 40 }, (float)font.baseSize*2, 2, DARKGRAY);
+            DrawRectangleLines(40, 40, (int)(textSize.x*2), (int)(textSize.y*2), LIGHTGRAY);
+
+            DrawText(TextFormat("FONT GLYPHS: %i", font.glyphCount), 40, 300, 20, GRAY);
+            DrawText(TextFormat("%i x MeasureTextEx() with glyph lookup: %.3f ms", MEASURE_ITERATIONS, lookupTime), 40, 340, 20, DARKGREEN);
+            DrawText(TextFormat("%i x MeasureTextEx() with linear search: %.3f ms", MEASURE_ITERATIONS, linearTime), 40, 370, 20, MAROON);
+
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFont(font);       // Unload font (also frees lookup, shared with fontLinear)
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
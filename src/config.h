@@ -62,6 +62,9 @@
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
+// Capture screenshots and GIF frames asynchronously, screen readback is resolved some frames later (OpenGL 3.3+)
+// and images encoding is done on background worker thread (SUPPORT_WORKER_THREADS)
+#define SUPPORT_ASYNC_SCREEN_CAPTURE    1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
@@ -92,6 +95,8 @@
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
+#define MAX_SCREEN_CAPTURES             4       // Max screen captures waiting for readback (async capture)
+
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -164,12 +169,16 @@
 //#define SUPPORT_FILEFORMAT_PVR          1
 
 // Support image export functionality (.png, .bmp, .tga, .jpg, .qoi)
+// NOTE: If SUPPORT_COMPRESSION_API is enabled, PNG files are filtered and compressed in parallel with sdefl
 #define SUPPORT_IMAGE_EXPORT            1
 // Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 #define SUPPORT_IMAGE_GENERATION        1
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support image import cache: processed images stored as KTX files, keyed by source content hash
+// NOTE: Cache is only used by LoadTexture() once a cache directory is set with SetTextureImportCache()
+#define SUPPORT_TEXTURE_IMPORT_CACHE    1
 
 
 //------------------------------------------------------------------------------------
@@ -181,6 +190,9 @@
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT          1
 #define SUPPORT_FILEFORMAT_TTF          1
+// Support dynamic fonts: TTF/OTF glyphs rasterized on demand into a glyph cache atlas, LoadFontDynamic()
+// NOTE: Requires SUPPORT_FILEFORMAT_TTF, font data is kept in memory while the font is loaded
+#define SUPPORT_FONT_GLYPH_CACHE        1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -188,7 +200,7 @@
 
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
+#define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers (per-thread) used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
 
@@ -241,9 +253,12 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Allow some heavy processing functions (image generation...) to split work across multiple threads
+#define SUPPORT_WORKER_THREADS          1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       128       // Max length of one trace-log message
+#define MAX_WORKER_THREADS              4       // Max number of threads used by worker jobs (including calling thread)
 
 #endif // CONFIG_H
@@ -11,7 +11,7 @@
 *     In those cases data is loaded uncompressed and format is returned.
 * 
 *   TODO:
-*     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx_to_memory()
+*     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx()
 *     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
 *
 *   CONFIGURATION:
@@ -66,7 +66,7 @@ RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
-RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+RLAPI int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
 #if defined(__cplusplus)
 }
@@ -368,8 +368,36 @@ void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_
 #endif
 
 #if defined(RL_GPUTEX_SUPPORT_KTX)
+// KTX 1.1 Header
+// v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+// v2.0 - http://github.khronos.org/KTX-Specification/ - Final specs by 2021-04-18
+typedef struct {
+    char id[12];                            // Identifier: "«KTX 11»\r\n\x1A\n"         // KTX 2.0: "«KTX 22»\r\n\x1A\n"
+    unsigned int endianness;                // Little endian: 0x01 0x02 0x03 0x04
+    unsigned int gl_type;                   // For compressed textures, glType must equal 0
+    unsigned int gl_type_size;              // For compressed texture data, usually 1
+    unsigned int gl_format;                 // For compressed textures is 0
+    unsigned int gl_internal_format;        // Compressed internal format
+    unsigned int gl_base_internal_format;   // Same as glFormat (RGB, RGBA, ALPHA...)   // KTX 2.0: UInt32 vkFormat
+    unsigned int width;                     // Texture image width in pixels
+    unsigned int height;                    // Texture image height in pixels
+    unsigned int depth;                     // For 2D textures is 0
+    unsigned int elements;                  // Number of array elements, usually 0
+    unsigned int faces;                     // Cubemap faces, for no-cubemap = 1
+    unsigned int mipmap_levels;             // Non-mipmapped textures = 1
+    unsigned int key_value_data_size;       // Used to encode any arbitrary data...     // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
+                                                                                        // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
+    // KTX 2.0 defines additional header elements...
+} ktx_header;
+
+// KTX key-value pair used to store raylib pixel format, it avoids mapping OpenGL formats back
+// NOTE: Key-value pair: UInt32 keyAndValueByteSize + key (null terminated) + value, padded to 4 bytes
+#define KTX_PIXELFORMAT_KEY         "raylib.pixelformat"
+#define KTX_PIXELFORMAT_KEY_SIZE    19      // Including null terminator
+#define KTX_PIXELFORMAT_ENTRY_SIZE  28      // 4 + 19 + 4 = 27 -> padded to 28 bytes
+
 // Load KTX compressed image data (ETC1/ETC2 compression)
-// TODO: Review KTX loading, many things changed!
+// NOTE: All mipmap levels are loaded, consecutive in memory (as expected by raylib Image)
 void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
 {
     void *image_data = NULL;        // Image data pointer
@@ -385,32 +413,9 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
     // GL_COMPRESSED_RGB8_ETC2          0x9274
     // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
 
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/
-
-    // KTX 1.1 Header
-    // TODO: Support KTX 2.2 specs!
-    typedef struct {
-        char id[12];                            // Identifier: "«KTX 11»\r\n\x1A\n"
-        unsigned int endianness;                // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int gl_type;                   // For compressed textures, glType must equal 0
-        unsigned int gl_type_size;              // For compressed texture data, usually 1
-        unsigned int gl_format;                 // For compressed textures is 0
-        unsigned int gl_internal_format;        // Compressed internal format
-        unsigned int gl_base_internal_format;   // Same as glFormat (RGB, RGBA, ALPHA...)
-        unsigned int width;                     // Texture image width in pixels
-        unsigned int height;                    // Texture image height in pixels
-        unsigned int depth;                     // For 2D textures is 0
-        unsigned int elements;                  // Number of array elements, usually 0
-        unsigned int faces;                     // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmap_levels;             // Non-mipmapped textures = 1
-        unsigned int key_value_data_size;       // Used to encode any arbitrary data...
-    } ktx_header;
-
     // NOTE: Before start of every mipmap data block, we have: unsigned int data_size
 
-    if (file_data_ptr != NULL)
+    if ((file_data_ptr != NULL) && (file_size >= sizeof(ktx_header)))
     {
         ktx_header *header = (ktx_header *)file_data_ptr;
 
@@ -419,28 +424,83 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
         {
             LOG("WARNING: IMAGE: KTX file data not valid");
         }
+        else if ((sizeof(ktx_header) + header->key_value_data_size) > file_size)
+        {
+            LOG("WARNING: IMAGE: KTX file data size not valid");
+        }
         else
         {
             file_data_ptr += sizeof(ktx_header);           // Move file data pointer
 
             *width = header->width;
             *height = header->height;
-            *mips = header->mipmap_levels;
+            *mips = (header->mipmap_levels > 0)? header->mipmap_levels : 1;
+            *format = 0;
+
+            if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+            else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+            else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+
+            // Look for raylib pixel format in key-value data (files saved by rl_save_ktx())
+            unsigned char *key_value_ptr = file_data_ptr;
+            unsigned char *key_value_end = file_data_ptr + header->key_value_data_size;
+
+            while ((key_value_ptr + 4) <= key_value_end)
+            {
+                unsigned int key_value_size = 0;
+                memcpy(&key_value_size, key_value_ptr, 4);
+
+                if (key_value_size > (unsigned int)(key_value_end - key_value_ptr - 4)) break;
+
+                if ((key_value_size == (KTX_PIXELFORMAT_KEY_SIZE + 4)) && (memcmp(key_value_ptr + 4, KTX_PIXELFORMAT_KEY, KTX_PIXELFORMAT_KEY_SIZE) == 0))
+                {
+                    memcpy(format, key_value_ptr + 4 + KTX_PIXELFORMAT_KEY_SIZE, 4);
+                }
+
+                key_value_ptr += 4 + ((key_value_size + 3) & ~3u);
+            }
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
+            // Compute total data size for all mipmap levels, validating every level size
+            unsigned char *mip_data_ptr = file_data_ptr;
+            unsigned int total_size = 0;
+            int mip_count = 0;
 
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+            for (; mip_count < *mips; mip_count++)
+            {
+                unsigned int mip_size = 0;
 
-            memcpy(image_data, file_data_ptr, data_size);
+                if ((mip_data_ptr + 4) > (file_data + file_size)) break;
+                memcpy(&mip_size, mip_data_ptr, 4);
+                if (mip_size > (unsigned int)((file_data + file_size) - mip_data_ptr - 4)) break;
 
-            if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+                total_size += mip_size;
+                mip_data_ptr += 4 + ((mip_size + 3) & ~3u);    // Mip padding to 4 bytes
+            }
+
+            if ((mip_count == 0) || (total_size == 0)) LOG("WARNING: IMAGE: KTX file image data not valid");
+            else
+            {
+                if (mip_count < *mips) LOG("WARNING: IMAGE: KTX file contains only %i mipmap levels", mip_count);
+                *mips = mip_count;
 
-            // TODO: Support uncompressed data formats? Right now it returns format = 0!
+                image_data = RL_MALLOC(total_size*sizeof(unsigned char));
+
+                unsigned char *image_data_ptr = (unsigned char *)image_data;
+
+                for (int i = 0; i < mip_count; i++)
+                {
+                    unsigned int mip_size = 0;
+                    memcpy(&mip_size, file_data_ptr, 4);
+                    memcpy(image_data_ptr, file_data_ptr + 4, mip_size);
+
+                    image_data_ptr += mip_size;
+                    file_data_ptr += 4 + ((mip_size + 3) & ~3u);
+                }
+            }
+
+            // TODO: Support uncompressed data formats from other tools? Right now it returns format = 0!
         }
     }
 
@@ -449,38 +509,20 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
 // Save image data as KTX file
 // NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
-// TODO: Review KTX saving, many things changed!
+// NOTE: raylib pixel format is stored as key-value data to be recovered on loading
 int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps)
 {
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/ - Final specs by 2021-04-18
-    typedef struct {
-        char id[12];                            // Identifier: "«KTX 11»\r\n\x1A\n"         // KTX 2.0: "«KTX 22»\r\n\x1A\n"
-        unsigned int endianness;                // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int gl_type;                   // For compressed textures, glType must equal 0
-        unsigned int gl_type_size;              // For compressed texture data, usually 1
-        unsigned int gl_format;                 // For compressed textures is 0
-        unsigned int gl_internal_format;        // Compressed internal format
-        unsigned int gl_base_internal_format;   // Same as glFormat (RGB, RGBA, ALPHA...)   // KTX 2.0: UInt32 vkFormat
-        unsigned int width;                     // Texture image width in pixels
-        unsigned int height;                    // Texture image height in pixels
-        unsigned int depth;                     // For 2D textures is 0
-        unsigned int elements;                  // Number of array elements, usually 0
-        unsigned int faces;                     // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmap_levels;             // Non-mipmapped textures = 1
-        unsigned int key_value_data_size;       // Used to encode any arbitrary data...     // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
-                                                                                            // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
-        // KTX 2.0 defines additional header elements...
-    } ktx_header;
+    if (mipmaps < 1) mipmaps = 1;
 
     // Calculate file data_size required
-    int data_size = sizeof(ktx_header);
+    int data_size = sizeof(ktx_header) + KTX_PIXELFORMAT_ENTRY_SIZE;
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
+        data_size += 4 + ((get_pixel_data_size(w, h, format) + 3) & ~3);  // Image size + level data (padded)
         w /= 2; h /= 2;
+        if (w < 1) w = 1;
+        if (h < 1) h = 1;
     }
 
     unsigned char *file_data = RL_CALLOC(data_size, 1);
@@ -496,7 +538,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     // Get the image header
     memcpy(header.id, ktx_identifier, 12);  // KTX 1.1 signature
-    header.endianness = 0;
+    header.endianness = 0x04030201;
     header.gl_type = 0;                     // Obtained from format
     header.gl_type_size = 1;
     header.gl_format = 0;                   // Obtained from format
@@ -508,19 +550,26 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.elements = 0;
     header.faces = 1;
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
-    header.key_value_data_size = 0;         // No extra data after the header
+    header.key_value_data_size = KTX_PIXELFORMAT_ENTRY_SIZE;
 
     rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
     header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
 
     // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
 
-    if (header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
+    if ((int)header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", (int)header.gl_format);
     else
     {
         memcpy(file_data_ptr, &header, sizeof(ktx_header));
         file_data_ptr += sizeof(ktx_header);
 
+        // Save raylib pixel format key-value pair
+        unsigned int key_value_size = KTX_PIXELFORMAT_KEY_SIZE + 4;
+        memcpy(file_data_ptr, &key_value_size, 4);
+        memcpy(file_data_ptr + 4, KTX_PIXELFORMAT_KEY, KTX_PIXELFORMAT_KEY_SIZE);
+        memcpy(file_data_ptr + 4 + KTX_PIXELFORMAT_KEY_SIZE, &format, 4);
+        file_data_ptr += KTX_PIXELFORMAT_ENTRY_SIZE;
+
         int temp_width = width;
         int temp_height = height;
         int data_offset = 0;
@@ -535,8 +584,10 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
             temp_width /= 2;
             temp_height /= 2;
+            if (temp_width < 1) temp_width = 1;
+            if (temp_height < 1) temp_height = 1;
             data_offset += data_size;
-            file_data_ptr += (4 + data_size);
+            file_data_ptr += (4 + ((data_size + 3) & ~3u));
         }
     }
 
@@ -549,7 +600,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), data_size, file);
 
         if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
-        else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+        else if (count != (unsigned int)data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
         else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
 
         int result = fclose(file);
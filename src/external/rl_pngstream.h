@@ -0,0 +1,840 @@
+/**********************************************************************************************
+*
+*   rl_pngstream - PNG rows streaming decoder with seekable checkpoints
+*
+*   DESCRIPTION:
+*
+*     Decode PNG image files row by row, reading compressed data directly from file
+*     (or from file data already loaded in memory), only one scanline and the inflate
+*     sliding window (32 KB) are kept in memory.
+*
+*     Decoder state is saved (row checkpoint) every checkpoint_rows rows while decoding,
+*     so, seeking to a row resumes decoding from the nearest previous checkpoint instead
+*     of decoding again from the first row. Checkpoints are created on demand, every
+*     checkpoint takes about 36 KB (inflate window and huffman tables) plus one row.
+*
+*     Output rows are always 8 bit per channel:
+*       - Grayscale:        1 channel
+*       - Grayscale+alpha:  2 channels
+*       - RGB:              3 channels
+*       - RGBA, palette:    4 channels
+*
+*   CONFIGURATION:
+*       #define RL_PNGSTREAM_NO_STDIO
+*           Do not include stdio.h, rl_png_stream_open() is not available, file data
+*           must be loaded by the user and streamed with rl_png_stream_open_memory()
+*
+*   LIMITATIONS:
+*     - Interlaced (Adam7) images are not supported
+*     - 16 bit per channel images are reduced to 8 bit
+*     - Chunks CRC is not checked, tRNS chunk only used for palette images
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RL_PNGSTREAM_H
+#define RL_PNGSTREAM_H
+
+#ifndef RLAPI
+    #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct rl_png_stream rl_png_stream;     // PNG stream decoder (opaque)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Open PNG stream from file, only header chunks are read, returns NULL on failure
+// NOTE: checkpoint_rows defines the rows interval between decoder checkpoints (~36 KB each)
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+RLAPI rl_png_stream *rl_png_stream_open(const char *file_name, int checkpoint_rows);
+#endif
+// Open PNG stream from file data in memory, returns NULL on failure
+// NOTE: Stream takes data ownership, data is freed with RL_PNGSTREAM_FREE() on close (or failure)
+RLAPI rl_png_stream *rl_png_stream_open_memory(unsigned char *data, int size, int checkpoint_rows);
+RLAPI void rl_png_stream_close(rl_png_stream *png);
+
+// Get image size and output channels (1, 2, 3 or 4)
+RLAPI void rl_png_stream_info(const rl_png_stream *png, int *width, int *height, int *channels);
+
+// Decode next row into 'row' (width*channels bytes), returns decoded row index or -1 on failure
+RLAPI int rl_png_stream_read_row(rl_png_stream *png, unsigned char *row);
+
+// Seek stream to row, next rl_png_stream_read_row() call returns that row, returns 0 on failure
+RLAPI int rl_png_stream_seek_row(rl_png_stream *png, int row);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RL_PNGSTREAM_H
+
+
+/***********************************************************************************
+*
+*   RL_PNGSTREAM IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RL_PNGSTREAM_IMPLEMENTATION)
+
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+    #include <stdio.h>      // Required for: FILE, fopen(), fseek(), fread(), fclose()
+#endif
+#include <string.h>         // Required for: memcpy(), memset(), memcmp()
+
+#ifndef RL_PNGSTREAM_MALLOC
+    #include <stdlib.h>     // Required for: malloc(), calloc(), free()
+
+    #define RL_PNGSTREAM_MALLOC(sz)     malloc(sz)
+    #define RL_PNGSTREAM_CALLOC(n,sz)   calloc(n,sz)
+    #define RL_PNGSTREAM_FREE(p)        free(p)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RL_PNG_WINDOW_SIZE      32768       // Inflate sliding window size (max deflate distance)
+#define RL_PNG_FAST_BITS            9       // Huffman decoding lookup table bits
+#define RL_PNG_INPUT_SIZE       16384       // Input buffer size (compressed data)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Canonical huffman decoding table
+typedef struct {
+    unsigned short fast[1 << RL_PNG_FAST_BITS];     // Fast lookup: (length << 9) | symbol, 0 if code is longer
+    short count[16];                                // Number of codes of each length
+    short symbol[288];                              // Symbols ordered by code
+} rl_png_huffman;
+
+// Inflate decoder state
+// NOTE: State is a plain struct with no pointers, it can be copied to create a checkpoint
+typedef struct {
+    long in_offset;                 // File offset of next compressed byte
+    int chunk_remaining;            // Bytes remaining on current IDAT chunk
+    unsigned int bit_buf;           // Bits buffer
+    int bit_cnt;                    // Bits available on buffer
+
+    int final_block;                // Current block is the last one
+    int block_type;                 // Current block type: 0-stored, 1-fixed, 2-dynamic, -1-header required
+    int stored_remaining;           // Bytes remaining on stored block
+    int copy_len;                   // Pending match bytes to copy
+    int copy_dist;                  // Pending match distance
+    int done;                       // Stream finished
+    int input_end;                  // No more compressed data available, zeros are returned
+    int error;                      // Stream corrupted
+
+    unsigned int out_pos;           // Total output bytes (window position)
+    rl_png_huffman lit;             // Literal/length codes
+    rl_png_huffman dist;            // Distance codes
+    unsigned char window[RL_PNG_WINDOW_SIZE];   // Sliding window (last output bytes)
+} rl_png_inflate;
+
+// Decoder row checkpoint, state saved at the beginning of a row
+// NOTE: Inflate state is about 36 KB (32 KB window + huffman tables), previous row is allocated apart
+typedef struct {
+    rl_png_inflate state;           // Inflate state
+    unsigned char *prev_row;        // Previous row (unfiltered) required by filters
+} rl_png_checkpoint;
+
+struct rl_png_stream {
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+    FILE *file;                     // PNG file (NULL if streaming from memory)
+#endif
+    unsigned char *data;            // PNG file data (owned, NULL if streaming from file)
+    long data_size;                 // PNG file data size
+    int width;                      // Image width
+    int height;                     // Image height
+    int bit_depth;                  // Bits per sample
+    int color_type;                 // PNG color type
+    int channels;                   // Output channels
+    int row_bytes;                  // Raw row size (no filter byte)
+    int bpp;                        // Filter bytes per pixel (at least 1)
+    unsigned char palette[256*4];   // Palette colors (RGBA)
+
+    unsigned char input[RL_PNG_INPUT_SIZE];     // Input buffer
+    long input_start;               // File offset of input buffer
+    int input_size;                 // Valid bytes on input buffer
+
+    rl_png_inflate state;           // Current inflate state
+    unsigned char *prev_row;        // Previous row (unfiltered)
+    unsigned char *cur_row;         // Current row, filter type byte + data
+    int next_row;                   // Next row to decode
+
+    int checkpoint_rows;            // Rows interval between checkpoints
+    int checkpoint_count;           // Number of checkpoints slots
+    rl_png_checkpoint *checkpoints; // Row checkpoints, state is saved at rows multiple of checkpoint_rows
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static rl_png_stream *rl_png_stream_init(rl_png_stream *png, int checkpoint_rows);
+static int rl_png_read(rl_png_stream *png, long offset, unsigned char *dst, int size);
+static unsigned int rl_png_read32(const unsigned char *data);
+static int rl_png_next_byte(rl_png_stream *png);
+static int rl_png_bits(rl_png_stream *png, int count);
+static int rl_png_build(rl_png_huffman *h, const unsigned char *lengths, int count);
+static int rl_png_decode(rl_png_stream *png, const rl_png_huffman *h);
+static int rl_png_block_header(rl_png_stream *png);
+static int rl_png_inflate_read(rl_png_stream *png, unsigned char *dst, int size);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+// Open PNG stream from file, only header chunks are read
+rl_png_stream *rl_png_stream_open(const char *file_name, int checkpoint_rows)
+{
+    FILE *file = fopen(file_name, "rb");
+    if (file == NULL) return NULL;
+
+    rl_png_stream *png = (rl_png_stream *)RL_PNGSTREAM_CALLOC(1, sizeof(rl_png_stream));
+    png->file = file;
+
+    return rl_png_stream_init(png, checkpoint_rows);
+}
+#endif
+
+// Open PNG stream from file data in memory, only header chunks are read
+rl_png_stream *rl_png_stream_open_memory(unsigned char *data, int size, int checkpoint_rows)
+{
+    if (data == NULL) return NULL;
+
+    rl_png_stream *png = (rl_png_stream *)RL_PNGSTREAM_CALLOC(1, sizeof(rl_png_stream));
+    png->data = data;
+    png->data_size = size;
+
+    return rl_png_stream_init(png, checkpoint_rows);
+}
+
+// Close PNG stream
+void rl_png_stream_close(rl_png_stream *png)
+{
+    if (png == NULL) return;
+
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+    if (png->file != NULL) fclose(png->file);
+#endif
+    RL_PNGSTREAM_FREE(png->data);
+
+    if (png->checkpoints != NULL)
+    {
+        for (int i = 0; i < png->checkpoint_count; i++) RL_PNGSTREAM_FREE(png->checkpoints[i].prev_row);
+        RL_PNGSTREAM_FREE(png->checkpoints);
+    }
+
+    RL_PNGSTREAM_FREE(png->prev_row);
+    RL_PNGSTREAM_FREE(png->cur_row);
+    RL_PNGSTREAM_FREE(png);
+}
+
+// Get image size and output channels
+void rl_png_stream_info(const rl_png_stream *png, int *width, int *height, int *channels)
+{
+    if (width != NULL) *width = png->width;
+    if (height != NULL) *height = png->height;
+    if (channels != NULL) *channels = png->channels;
+}
+
+// Decode next row into output buffer
+int rl_png_stream_read_row(rl_png_stream *png, unsigned char *row)
+{
+    if ((png->next_row >= png->height) || png->state.error) return -1;
+
+    // Save checkpoint at the beginning of the row if required
+    if ((png->next_row%png->checkpoint_rows) == 0)
+    {
+        rl_png_checkpoint *checkpoint = &png->checkpoints[png->next_row/png->checkpoint_rows];
+
+        if (checkpoint->prev_row == NULL)
+        {
+            checkpoint->prev_row = (unsigned char *)RL_PNGSTREAM_MALLOC(png->row_bytes);
+            memcpy(checkpoint->prev_row, png->prev_row, png->row_bytes);
+            checkpoint->state = png->state;
+        }
+    }
+
+    if (rl_png_inflate_read(png, png->cur_row, png->row_bytes + 1) != (png->row_bytes + 1)) return -1;
+
+    // Unfilter row
+    unsigned char *cur = png->cur_row + 1;
+    unsigned char *prev = png->prev_row;
+    int bpp = png->bpp;
+
+    switch (png->cur_row[0])
+    {
+        case 0: break;      // None
+        case 1: for (int i = bpp; i < png->row_bytes; i++) cur[i] += cur[i - bpp]; break;     // Sub
+        case 2: for (int i = 0; i < png->row_bytes; i++) cur[i] += prev[i]; break;            // Up
+        case 3:             // Average
+        {
+            for (int i = 0; i < bpp; i++) cur[i] += prev[i]/2;
+            for (int i = bpp; i < png->row_bytes; i++) cur[i] += (unsigned char)((cur[i - bpp] + prev[i])/2);
+        } break;
+        case 4:             // Paeth
+        {
+            for (int i = 0; i < png->row_bytes; i++)
+            {
+                int a = (i >= bpp)? cur[i - bpp] : 0;
+                int b = prev[i];
+                int c = (i >= bpp)? prev[i - bpp] : 0;
+                int p = a + b - c;
+                int pa = (p > a)? p - a : a - p;
+                int pb = (p > b)? p - b : b - p;
+                int pc = (p > c)? p - c : c - p;
+
+                if ((pa <= pb) && (pa <= pc)) cur[i] += (unsigned char)a;
+                else if (pb <= pc) cur[i] += (unsigned char)b;
+                else cur[i] += (unsigned char)c;
+            }
+        } break;
+        default: png->state.error = 1; return -1;
+    }
+
+    // Convert row to 8 bit output channels
+    int samples = png->row_bytes*8/png->bit_depth;      // NOTE: Could include padding samples
+
+    if (png->bit_depth == 8)
+    {
+        if (png->color_type == 3)
+        {
+            for (int i = 0; i < png->width; i++) memcpy(row + i*4, png->palette + cur[i]*4, 4);
+        }
+        else memcpy(row, cur, (size_t)png->width*png->channels);
+    }
+    else if (png->bit_depth == 16)
+    {
+        for (int i = 0; i < png->width*png->channels; i++) row[i] = cur[i*2];     // High byte
+    }
+    else
+    {
+        // Packed samples (1, 2, 4 bits), only grayscale or palette
+        int depth = png->bit_depth;
+        int mask = (1 << depth) - 1;
+        int scale = (png->color_type == 0)? 255/mask : 1;
+
+        for (int i = 0; (i < png->width) && (i < samples); i++)
+        {
+            int value = (cur[(i*depth)/8] >> (8 - depth - (i*depth)%8)) & mask;
+
+            if (png->color_type == 3) memcpy(row + i*4, png->palette + value*4, 4);
+            else row[i] = (unsigned char)(value*scale);
+        }
+    }
+
+    // Current row becomes previous row
+    memcpy(png->prev_row, cur, png->row_bytes);
+
+    return png->next_row++;
+}
+
+// Seek stream to row, resuming from nearest previous checkpoint
+int rl_png_stream_seek_row(rl_png_stream *png, int row)
+{
+    if ((row < 0) || (row >= png->height)) return 0;
+
+    // Nearest saved checkpoint before requested row
+    int index = row/png->checkpoint_rows;
+    while ((index > 0) && (png->checkpoints[index].prev_row == NULL)) index--;
+
+    int checkpoint_row = index*png->checkpoint_rows;
+
+    // Restore checkpoint if current position is not between checkpoint and requested row
+    if ((png->next_row > row) || (png->next_row < checkpoint_row))
+    {
+        rl_png_checkpoint *checkpoint = &png->checkpoints[index];
+
+        if (checkpoint->prev_row == NULL) return 0;     // NOTE: First checkpoint is always saved on first read
+
+        png->state = checkpoint->state;
+        memcpy(png->prev_row, checkpoint->prev_row, png->row_bytes);
+        png->next_row = checkpoint_row;
+    }
+
+    // Decode and discard rows until requested one
+    if (png->next_row < row)
+    {
+        unsigned char *temp = (unsigned char *)RL_PNGSTREAM_MALLOC((size_t)png->width*png->channels);
+
+        while (png->next_row < row)
+        {
+            if (rl_png_stream_read_row(png, temp) < 0) break;
+        }
+
+        RL_PNGSTREAM_FREE(temp);
+    }
+
+    return (png->next_row == row);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Read PNG header chunks and initialize decoder, stream is closed on failure
+static rl_png_stream *rl_png_stream_init(rl_png_stream *png, int checkpoint_rows)
+{
+    unsigned char header[8 + 25] = { 0 };
+
+    if ((rl_png_read(png, 0, header, sizeof(header)) != sizeof(header)) ||
+        (memcmp(header, "\x89PNG\r\n\x1a\n", 8) != 0) || (memcmp(header + 12, "IHDR", 4) != 0) ||
+        (header[28] != 0))      // Interlaced images not supported
+    {
+        rl_png_stream_close(png);
+        return NULL;
+    }
+
+    png->width = (int)rl_png_read32(header + 16);
+    png->height = (int)rl_png_read32(header + 20);
+    png->bit_depth = header[24];
+    png->color_type = header[25];
+
+    int samples = 0;
+    switch (png->color_type)
+    {
+        case 0: samples = 1; png->channels = 1; break;      // Grayscale
+        case 2: samples = 3; png->channels = 3; break;      // RGB
+        case 3: samples = 1; png->channels = 4; break;      // Palette
+        case 4: samples = 2; png->channels = 2; break;      // Grayscale + alpha
+        case 6: samples = 4; png->channels = 4; break;      // RGBA
+        default: break;
+    }
+
+    if ((samples == 0) || (png->width <= 0) || (png->height <= 0))
+    {
+        rl_png_stream_close(png);
+        return NULL;
+    }
+
+    png->row_bytes = (int)(((long long)png->width*samples*png->bit_depth + 7)/8);
+    png->bpp = (samples*png->bit_depth + 7)/8;
+
+    // Default palette alpha is opaque
+    for (int i = 0; i < 256; i++) png->palette[i*4 + 3] = 255;
+
+    // Read chunks until first image data chunk
+    long offset = 8 + 25;
+
+    while (1)
+    {
+        unsigned char chunk[8] = { 0 };
+
+        if (rl_png_read(png, offset, chunk, 8) != 8) break;
+
+        unsigned int length = rl_png_read32(chunk);
+
+        if (memcmp(chunk + 4, "IDAT", 4) == 0)
+        {
+            png->state.in_offset = offset + 8;
+            png->state.chunk_remaining = (int)length;
+            break;
+        }
+        else if ((memcmp(chunk + 4, "PLTE", 4) == 0) && (length <= 256*3))
+        {
+            unsigned char colors[256*3] = { 0 };
+            if (rl_png_read(png, offset + 8, colors, (int)length) != (int)length) break;
+            for (unsigned int i = 0; i < length/3; i++) memcpy(png->palette + i*4, colors + i*3, 3);
+        }
+        else if ((memcmp(chunk + 4, "tRNS", 4) == 0) && (png->color_type == 3) && (length <= 256))
+        {
+            unsigned char alpha[256] = { 0 };
+            if (rl_png_read(png, offset + 8, alpha, (int)length) != (int)length) break;
+            for (unsigned int i = 0; i < length; i++) png->palette[i*4 + 3] = alpha[i];
+        }
+        else if (memcmp(chunk + 4, "IEND", 4) == 0) break;
+
+        offset += 12 + length;
+    }
+
+    if (png->state.in_offset == 0)
+    {
+        rl_png_stream_close(png);
+        return NULL;
+    }
+
+    png->prev_row = (unsigned char *)RL_PNGSTREAM_CALLOC(png->row_bytes, 1);
+    png->cur_row = (unsigned char *)RL_PNGSTREAM_CALLOC(png->row_bytes + 1, 1);
+
+    png->state.block_type = -1;
+    png->input_start = -1;
+
+    // Skip zlib header (2 bytes), bit buffer is empty at this point
+    rl_png_next_byte(png);
+    rl_png_next_byte(png);
+
+    png->checkpoint_rows = (checkpoint_rows > 0)? checkpoint_rows : 256;
+    png->checkpoint_count = (png->height + png->checkpoint_rows - 1)/png->checkpoint_rows;
+    png->checkpoints = (rl_png_checkpoint *)RL_PNGSTREAM_CALLOC(png->checkpoint_count, sizeof(rl_png_checkpoint));
+
+    return png;
+}
+
+// Read data from PNG file (or file data) at offset, returns bytes read
+static int rl_png_read(rl_png_stream *png, long offset, unsigned char *dst, int size)
+{
+#if !defined(RL_PNGSTREAM_NO_STDIO)
+    if (png->file != NULL)
+    {
+        if (fseek(png->file, offset, SEEK_SET) != 0) return 0;
+        return (int)fread(dst, 1, size, png->file);
+    }
+#endif
+    if ((offset < 0) || (offset >= png->data_size)) return 0;
+    if (size > (png->data_size - offset)) size = (int)(png->data_size - offset);
+
+    memcpy(dst, png->data + offset, size);
+
+    return size;
+}
+
+// Read big-endian 32bit value
+static unsigned int rl_png_read32(const unsigned char *data)
+{
+    return ((unsigned int)data[0] << 24) | ((unsigned int)data[1] << 16) | ((unsigned int)data[2] << 8) | (unsigned int)data[3];
+}
+
+// Get next compressed byte, moving through IDAT chunks, returns 0 on data end
+// NOTE: Bits could be requested ahead of last symbol, reaching data end is not an error
+static int rl_png_next_byte(rl_png_stream *png)
+{
+    rl_png_inflate *state = &png->state;
+
+    if (state->input_end) return 0;
+
+    while (state->chunk_remaining == 0)
+    {
+        // Skip current chunk CRC and read next chunk header
+        unsigned char chunk[8] = { 0 };
+        if ((rl_png_read(png, state->in_offset + 4, chunk, 8) != 8) || (memcmp(chunk + 4, "IDAT", 4) != 0))
+        {
+            state->input_end = 1;
+            return 0;
+        }
+
+        state->in_offset += 12;
+        state->chunk_remaining = (int)rl_png_read32(chunk);
+    }
+
+    // Refill input buffer if required
+    if ((state->in_offset < png->input_start) || (state->in_offset >= png->input_start + png->input_size))
+    {
+        png->input_start = state->in_offset;
+        png->input_size = rl_png_read(png, state->in_offset, png->input, RL_PNG_INPUT_SIZE);
+
+        if (png->input_size <= 0)
+        {
+            state->input_end = 1;
+            return 0;
+        }
+    }
+
+    int value = png->input[state->in_offset - png->input_start];
+
+    state->in_offset++;
+    state->chunk_remaining--;
+
+    return value;
+}
+
+// Get bits from stream (up to 16 bits)
+static int rl_png_bits(rl_png_stream *png, int count)
+{
+    rl_png_inflate *state = &png->state;
+
+    while (state->bit_cnt < count)
+    {
+        state->bit_buf |= (unsigned int)rl_png_next_byte(png) << state->bit_cnt;
+        state->bit_cnt += 8;
+    }
+
+    int value = (int)(state->bit_buf & ((1u << count) - 1));
+    state->bit_buf >>= count;
+    state->bit_cnt -= count;
+
+    return value;
+}
+
+// Build canonical huffman decoding table from code lengths
+static int rl_png_build(rl_png_huffman *h, const unsigned char *lengths, int count)
+{
+    short offsets[16] = { 0 };
+    int next_code[16] = { 0 };
+
+    memset(h, 0, sizeof(rl_png_huffman));
+
+    for (int i = 0; i < count; i++) h->count[lengths[i]]++;
+    h->count[0] = 0;
+
+    // Check for over-subscribed code set
+    int left = 1;
+    for (int len = 1; len < 16; len++)
+    {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0) return 0;
+    }
+
+    for (int len = 1; len < 15; len++) offsets[len + 1] = offsets[len] + h->count[len];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) h->symbol[offsets[lengths[i]]++] = (short)i;
+
+    // Fill fast lookup table, codes are stored bit-reversed in stream
+    int code = 0;
+    for (int len = 1; len < 16; len++)
+    {
+        code = (code + h->count[len - 1]) << 1;
+        next_code[len] = code;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int len = lengths[i];
+        if (len == 0) continue;
+
+        int value = next_code[len]++;
+
+        if (len <= RL_PNG_FAST_BITS)
+        {
+            int reversed = 0;
+            for (int b = 0; b < len; b++) reversed |= ((value >> b) & 1) << (len - 1 - b);
+
+            for (int j = reversed; j < (1 << RL_PNG_FAST_BITS); j += (1 << len)) h->fast[j] = (unsigned short)((len << 9) | i);
+        }
+    }
+
+    return 1;
+}
+
+// Decode one symbol from stream
+static int rl_png_decode(rl_png_stream *png, const rl_png_huffman *h)
+{
+    rl_png_inflate *state = &png->state;
+
+    // Try fast lookup, bits are only peeked
+    while (state->bit_cnt < RL_PNG_FAST_BITS)
+    {
+        state->bit_buf |= (unsigned int)rl_png_next_byte(png) << state->bit_cnt;
+        state->bit_cnt += 8;
+    }
+
+    unsigned short entry = h->fast[state->bit_buf & ((1 << RL_PNG_FAST_BITS) - 1)];
+
+    if (entry != 0)
+    {
+        int len = entry >> 9;
+        state->bit_buf >>= len;
+        state->bit_cnt -= len;
+
+        return entry & 0x1ff;
+    }
+
+    // Slow canonical decoding, bit by bit
+    int code = 0;
+    int first = 0;
+    int index = 0;
+
+    for (int len = 1; len < 16; len++)
+    {
+        code |= rl_png_bits(png, 1);
+        int count = h->count[len];
+
+        if ((code - count) < first) return h->symbol[index + (code - first)];
+
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+
+    state->error = 1;
+    return -1;
+}
+
+// Read block header and build required decoding tables
+static int rl_png_block_header(rl_png_stream *png)
+{
+    rl_png_inflate *state = &png->state;
+    unsigned char lengths[288 + 32] = { 0 };
+
+    state->final_block = rl_png_bits(png, 1);
+    state->block_type = rl_png_bits(png, 2);
+
+    if (state->block_type == 0)         // Stored block
+    {
+        // Discard remaining bits of current byte
+        rl_png_bits(png, state->bit_cnt%8);
+
+        int len = rl_png_bits(png, 16);
+        int nlen = rl_png_bits(png, 16);
+        if (len != (~nlen & 0xffff)) return 0;
+
+        state->stored_remaining = len;
+    }
+    else if (state->block_type == 1)    // Fixed huffman codes
+    {
+        int i = 0;
+        for (; i < 144; i++) lengths[i] = 8;
+        for (; i < 256; i++) lengths[i] = 9;
+        for (; i < 280; i++) lengths[i] = 7;
+        for (; i < 288; i++) lengths[i] = 8;
+        rl_png_build(&state->lit, lengths, 288);
+
+        for (i = 0; i < 30; i++) lengths[i] = 5;
+        rl_png_build(&state->dist, lengths, 30);
+    }
+    else if (state->block_type == 2)    // Dynamic huffman codes
+    {
+        static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        int nlen = rl_png_bits(png, 5) + 257;
+        int ndist = rl_png_bits(png, 5) + 1;
+        int ncode = rl_png_bits(png, 4) + 4;
+        if ((nlen > 286) || (ndist > 30)) return 0;
+
+        for (int i = 0; i < ncode; i++) lengths[order[i]] = (unsigned char)rl_png_bits(png, 3);
+        if (!rl_png_build(&state->lit, lengths, 19)) return 0;
+
+        memset(lengths, 0, sizeof(lengths));
+
+        for (int i = 0; i < nlen + ndist; )
+        {
+            int symbol = rl_png_decode(png, &state->lit);
+            if (symbol < 0) return 0;
+
+            if (symbol < 16) lengths[i++] = (unsigned char)symbol;
+            else
+            {
+                int len = 0;
+                int repeat = 0;
+
+                if (symbol == 16)
+                {
+                    if (i == 0) return 0;
+                    len = lengths[i - 1];
+                    repeat = 3 + rl_png_bits(png, 2);
+                }
+                else if (symbol == 17) repeat = 3 + rl_png_bits(png, 3);
+                else repeat = 11 + rl_png_bits(png, 7);
+
+                if ((i + repeat) > (nlen + ndist)) return 0;
+                while (repeat--) lengths[i++] = (unsigned char)len;
+            }
+        }
+
+        if (!rl_png_build(&state->lit, lengths, nlen)) return 0;
+        if (!rl_png_build(&state->dist, lengths + nlen, ndist)) return 0;
+    }
+    else return 0;
+
+    return 1;
+}
+
+// Inflate data into destination buffer, returns bytes written
+static int rl_png_inflate_read(rl_png_stream *png, unsigned char *dst, int size)
+{
+    static const short length_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const short length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short dist_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short dist_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    rl_png_inflate *state = &png->state;
+    int written = 0;
+
+    while ((written < size) && !state->error)
+    {
+        if (state->copy_len > 0)
+        {
+            // Copy pending match from window
+            while ((state->copy_len > 0) && (written < size))
+            {
+                unsigned char value = state->window[(state->out_pos - state->copy_dist) & (RL_PNG_WINDOW_SIZE - 1)];
+                state->window[state->out_pos & (RL_PNG_WINDOW_SIZE - 1)] = value;
+                state->out_pos++;
+                dst[written++] = value;
+                state->copy_len--;
+            }
+        }
+        else if (state->block_type == -1)
+        {
+            if (state->done) break;
+            if (!rl_png_block_header(png)) state->error = 1;
+        }
+        else if (state->block_type == 0)
+        {
+            if (state->stored_remaining == 0)
+            {
+                state->block_type = -1;
+                if (state->final_block) state->done = 1;
+            }
+            else
+            {
+                unsigned char value = (unsigned char)rl_png_bits(png, 8);
+                state->window[state->out_pos++ & (RL_PNG_WINDOW_SIZE - 1)] = value;
+                dst[written++] = value;
+                state->stored_remaining--;
+            }
+        }
+        else
+        {
+            int symbol = rl_png_decode(png, &state->lit);
+
+            if (symbol < 0) break;
+            else if (symbol < 256)
+            {
+                state->window[state->out_pos++ & (RL_PNG_WINDOW_SIZE - 1)] = (unsigned char)symbol;
+                dst[written++] = (unsigned char)symbol;
+            }
+            else if (symbol == 256)
+            {
+                state->block_type = -1;
+                if (state->final_block) state->done = 1;
+            }
+            else
+            {
+                symbol -= 257;
+                if (symbol >= 29) { state->error = 1; break; }
+
+                int len = length_base[symbol] + rl_png_bits(png, length_extra[symbol]);
+
+                int dist_symbol = rl_png_decode(png, &state->dist);
+                if ((dist_symbol < 0) || (dist_symbol >= 30)) { state->error = 1; break; }
+
+                int dist = dist_base[dist_symbol] + rl_png_bits(png, dist_extra[dist_symbol]);
+                if ((unsigned int)dist > state->out_pos) { state->error = 1; break; }
+
+                state->copy_len = len;
+                state->copy_dist = dist;
+            }
+        }
+    }
+
+    return written;
+}
+
+#endif // RL_PNGSTREAM_IMPLEMENTATION
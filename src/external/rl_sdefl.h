@@ -0,0 +1,199 @@
+/**********************************************************************************************
+*
+*   rl_sdefl - Deflate stream parts compressor, sdefl extension
+*
+*   DESCRIPTION:
+*
+*     Compress a deflate stream split in data parts, every part can be compressed independently
+*     (i.e. in parallel), using up to 32 KB of previous part data as preset dictionary.
+*     Compressed parts are concatenated in order to get a single valid deflate stream:
+*       - All parts except the last one are terminated with a sync flush (empty stored block)
+*       - Last part sets the final block flag
+*
+*     Compression relies on sdefl internal functions, so, implementation must be included
+*     in the same translation unit as sdefl implementation, right after it:
+*
+*       #define SDEFL_IMPLEMENTATION
+*       #include "sdefl.h"
+*       #define RL_SDEFL_IMPLEMENTATION
+*       #include "rl_sdefl.h"
+*
+*   DEPENDENCIES:
+*       sdefl.h - Deflate compressor by Micha Mettke (declarations and implementation)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RL_SDEFL_H
+#define RL_SDEFL_H
+
+#ifndef RLAPI
+    #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct sdefl;           // Compressor state, defined by sdefl.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Compress data part of a deflate stream, returns compressed size
+// NOTE: 'dict' bytes before 'in' are used as preset dictionary (up to SDEFL_WIN_SIZ),
+// output buffer must be sdefl_bound(n) bytes plus 8 bytes for the sync flush marker
+RLAPI int rl_sdeflate_part(struct sdefl *s, void *out, const void *in, int dict, int n, int lvl, int last);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RL_SDEFL_H
+
+
+/***********************************************************************************
+*
+*   RL_SDEFL IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RL_SDEFL_IMPLEMENTATION)
+
+#if !defined(SDEFL_IMPLEMENTATION)
+    #error "rl_sdefl implementation requires sdefl implementation in the same translation unit"
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// NOTE: Same compression loop as sdefl_compr(), hash table is filled with dictionary
+// data first and last block is not marked as final but followed by a sync flush
+int rl_sdeflate_part(struct sdefl *s, void *out, const void *in, int dict, int n, int lvl, int last)
+{
+    static const unsigned char pref[] = { 8, 10, 14, 24, 30, 48, 65, 96, 130 };
+
+    const unsigned char *data = (const unsigned char *)in - dict;
+    unsigned char *q = (unsigned char *)out;
+    int maxChain = (lvl < 8)? (1 << (lvl + 1)) : (1 << 13);
+    int size = dict + n;
+    int i = 0;
+    int litlen = 0;
+
+    s->bits = s->bitcnt = 0;
+    for (int k = 0; k < SDEFL_HASH_SIZ; k++) s->tbl[k] = SDEFL_NIL;
+
+    // Preset dictionary: previous data is only hashed, not compressed
+    for (; i < dict; i++)
+    {
+        if ((size - i) > SDEFL_MIN_MATCH)
+        {
+            unsigned int h = sdefl_hash32(&data[i]);
+            s->prv[i & SDEFL_WIN_MSK] = s->tbl[h];
+            s->tbl[h] = i;
+        }
+    }
+
+    do
+    {
+        int blockEnd = ((i + SDEFL_BLK_MAX) < size)? (i + SDEFL_BLK_MAX) : size;
+
+        while (i < blockEnd)
+        {
+            struct sdefl_match m = { 0 };
+            int maxMatch = ((size - i) > SDEFL_MAX_MATCH)? SDEFL_MAX_MATCH : (size - i);
+            int niceMatch = (pref[lvl] < maxMatch)? pref[lvl] : maxMatch;
+            int run = 1;
+            int inc = 1;
+
+            if (maxMatch > SDEFL_MIN_MATCH) sdefl_fnd(&m, s, maxChain, maxMatch, data, i);
+
+            if ((lvl >= 5) && (m.len >= SDEFL_MIN_MATCH) && (m.len < niceMatch))
+            {
+                struct sdefl_match m2 = { 0 };
+                sdefl_fnd(&m2, s, maxChain, m.len + 1, data, i + 1);
+                m.len = (m2.len > m.len)? 0 : m.len;
+            }
+
+            if (m.len >= SDEFL_MIN_MATCH)
+            {
+                if (litlen)
+                {
+                    sdefl_seq(s, i - litlen, litlen);
+                    litlen = 0;
+                }
+
+                sdefl_seq(s, -m.off, m.len);
+                sdefl_reg_match(s, m.off, m.len);
+
+                if ((lvl < 2) && (m.len >= niceMatch)) inc = m.len;
+                else run = m.len;
+            }
+            else
+            {
+                s->freq.lit[data[i]]++;
+                litlen++;
+            }
+
+            int runInc = run*inc;
+
+            if ((size - (i + runInc)) > SDEFL_MIN_MATCH)
+            {
+                while (run-- > 0)
+                {
+                    unsigned int h = sdefl_hash32(&data[i]);
+                    s->prv[i & SDEFL_WIN_MSK] = s->tbl[h];
+                    s->tbl[h] = i;
+                    i += inc;
+                }
+            }
+            else i += runInc;
+        }
+
+        if (litlen)
+        {
+            sdefl_seq(s, i - litlen, litlen);
+            litlen = 0;
+        }
+
+        sdefl_flush(&q, s, last && (blockEnd == size), data);
+
+    } while (i < size);
+
+    if (!last)
+    {
+        // Sync flush: empty stored block, byte aligned
+        sdefl_put(&q, s, 0x00, 3);
+        if (s->bitcnt) sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+        sdefl_put(&q, s, 0x0000, 16);
+        sdefl_put(&q, s, 0xffff, 16);
+    }
+
+    if (s->bitcnt) sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+
+    return (int)(q - (unsigned char *)out);
+}
+
+#endif // RL_SDEFL_IMPLEMENTATION
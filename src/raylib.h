@@ -249,6 +249,49 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageView, image pixel data reference (no data copied), base mipmap level only
+typedef struct ImageView {
+    void *data;             // Pointer to view first pixel (not owned)
+    int width;              // View width
+    int height;             // View height
+    int stride;             // Bytes between consecutive rows
+    int format;             // Data format (PixelFormat type, uncompressed)
+} ImageView;
+
+// AnimImage, animated image stream (GIF, APNG), only current frame is kept in memory (RAM)
+typedef struct AnimImage {
+    Image image;            // Current frame image data (R8G8B8A8), updated in place
+    int frameCount;         // Total number of frames
+    int currentFrame;       // Current frame index
+    int frameDelay;         // Current frame delay in milliseconds
+    bool looping;           // Animation looping enable
+
+    int ctxType;            // Type of animation context (image filetype)
+    void *ctxData;          // Animation decoder context data, depends on type
+} AnimImage;
+
+// TiledImage, image file source to load regions from, full image is not kept in memory (RAM)
+typedef struct TiledImage {
+    int width;              // Full image width
+    int height;             // Full image height
+    int format;             // Regions data format (PixelFormat type)
+    int checkpointRows;     // Rows between decoder checkpoints (seeking granularity, ~36 KB per checkpoint)
+
+    int ctxType;            // Type of image context (streamed or fully loaded)
+    void *ctxData;          // Image decoder context data, depends on type
+} TiledImage;
+
+// ImageScratchStats, transient memory used by image processing functions (bytes)
+typedef struct ImageScratchStats {
+    int capacity;           // Scratch arena size (0 if disabled)
+    int arenaUsed;          // Scratch arena memory in use
+    int arenaPeak;          // Scratch arena peak memory in use
+    int transientUsed;      // Transient memory in use (scratch arena and heap)
+    int transientPeak;      // Transient peak memory in use (scratch arena and heap)
+    int arenaAllocs;        // Transient buffers allocated from scratch arena
+    int heapAllocs;         // Transient buffers allocated from heap (arena disabled or full)
+} ImageScratchStats;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -274,6 +317,18 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// StreamTexture, texture updated from CPU data through a ring of pixel buffers
+typedef struct StreamTexture {
+    Texture2D texture;          // Streamed texture
+    unsigned int *buffers;      // Pixel unpack buffers ring (GPU), NULL if not supported
+    int bufferCount;            // Pixel unpack buffers count
+    int currentBuffer;          // Pixel unpack buffer to be used by next upload
+    void *staging;              // Staging pixel data (CPU), used if pixel buffers not supported
+    Rectangle lockRec;          // Locked rectangle, uploaded on unlock
+    Rectangle dirtyRecs[4];     // Dirty rectangles, uploaded on next update
+    int dirtyCount;             // Dirty rectangles count
+} StreamTexture;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -301,8 +356,61 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int *glyphLookup;       // Codepoint to glyph index lookup (pages table), built on font loading, NULL uses linear search
+    void *glyphCache;       // Glyph cache data for dynamic fonts (LoadFontDynamic()), NULL for static fonts
+    void *kerning;          // Kerning pairs table (hashed glyph indices pairs), built on TTF font loading, NULL for no kerning
 } Font;
 
+// FontCacheStats, dynamic font glyph cache stats
+typedef struct FontCacheStats {
+    int pageCount;          // Glyph cache atlas pages in use
+    int glyphCount;         // Glyphs currently cached
+    unsigned int hits;      // Glyph lookups found in cache
+    unsigned int misses;    // Glyph lookups rasterized on demand
+    unsigned int evictions; // Glyphs evicted from cache (least recently used atlas page reused)
+} FontCacheStats;
+
+// TextLayout, text glyphs resolved and positioned for drawing (LoadTextLayout())
+typedef struct TextLayout {
+    int glyphCount;         // Number of glyphs to draw (spaces and line breaks not included)
+    int *codepoints;        // Glyphs codepoints
+    Rectangle *srcRecs;     // Glyphs source rectangles in font atlas, padding included (dynamic fonts resolve them on drawing)
+    Rectangle *dstRecs;     // Glyphs destination rectangles relative to text position, padding included
+    Vector2 size;           // Text size, same as MeasureTextEx()
+} TextLayout;
+
+// TextBox, text wrapped to a width with cached line breaks (LoadTextBox())
+// NOTE: Alignment, line spacing and drawn lines can be changed freely, text and width changes require functions
+typedef struct TextBox {
+    Font font;              // Text font
+    float fontSize;         // Text font size
+    float spacing;          // Text glyphs spacing
+    float width;            // Text wrap width, 0 for no wrapping (SetTextBoxWidth())
+    float lineSpacing;      // Line height, relative to font size (text line spacing on loading)
+    int alignment;          // Lines alignment (TextAlignment)
+    int firstLine;          // First line to draw (scrolling)
+    int maxLines;           // Lines to draw, 0 for all, last line ends with ellipsis if text continues
+    char *text;             // Text (UTF-8), owned by text box (SetTextBoxText(), AppendTextBoxText())
+    int textSize;           // Text size in bytes
+    int lineCount;          // Lines count, wrapped lines included
+    void *lineData;         // Lines data, cached line breaks
+} TextBox;
+
+// TextSpan, substring range in a text (TextSplitSpans())
+typedef struct TextSpan {
+    int position;           // Substring first byte in text
+    int length;             // Substring length in bytes
+} TextSpan;
+
+// TextLayoutCacheStats, text layouts cache stats (SetTextLayoutCache())
+typedef struct TextLayoutCacheStats {
+    int capacity;           // Maximum number of layouts cached
+    int layoutCount;        // Layouts currently cached
+    unsigned int hits;      // Text lookups found in cache
+    unsigned int misses;    // Text lookups laid out (not in cache)
+    unsigned int evictions; // Least recently used layouts evicted
+} TextLayoutCacheStats;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -846,13 +954,58 @@ typedef enum {
     CUBEMAP_LAYOUT_PANORAMA                 // Layout is defined by a panorama image (equirrectangular map)
 } CubemapLayout;
 
+// Texture import flags
+// NOTE: Processing applied to imported images, part of the import cache key
+typedef enum {
+    TEXTURE_IMPORT_MIPMAPS      = 0x00000001,   // Generate mipmaps
+    TEXTURE_IMPORT_PREMULTIPLY  = 0x00000002,   // Premultiply alpha (image converted to R8G8B8A8 before formatting)
+    TEXTURE_IMPORT_POT          = 0x00000004    // Resize canvas to power-of-two size (filled with BLANK)
+} TextureImportFlags;
+
+// PNG export compression levels
+// NOTE: Intermediate levels are also valid, PNG_COMPRESSION_DEFAULT is used by default
+typedef enum {
+    PNG_COMPRESSION_FAST = 0,               // Fastest compression, fixed rows filter (screenshots, tooling)
+    PNG_COMPRESSION_DEFAULT = 5,            // Default compression, adaptive rows filter
+    PNG_COMPRESSION_BEST = 8                // Best compression, slowest
+} PngCompressionLevel;
+
+// Image orientation transforms
+// NOTE: All 8 image orientations (dihedral group), applied by ImageTransform()
+typedef enum {
+    IMAGE_TRANSFORM_NONE = 0,               // No transform
+    IMAGE_TRANSFORM_ROTATE_CW,              // Rotate 90deg clockwise
+    IMAGE_TRANSFORM_ROTATE_180,             // Rotate 180deg
+    IMAGE_TRANSFORM_ROTATE_CCW,             // Rotate 90deg counter-clockwise
+    IMAGE_TRANSFORM_FLIP_HORIZONTAL,        // Flip horizontally
+    IMAGE_TRANSFORM_FLIP_VERTICAL,          // Flip vertically
+    IMAGE_TRANSFORM_TRANSPOSE,              // Flip over main diagonal (top-left to bottom-right)
+    IMAGE_TRANSFORM_TRANSVERSE              // Flip over anti-diagonal (top-right to bottom-left)
+} ImageTransformType;
+
+// Image dithering methods
+// NOTE: Ordered methods process rows independently (multithreaded), error diffusion is sequential
+typedef enum {
+    DITHER_FLOYD_STEINBERG = 0,             // Error diffusion, Floyd-Steinberg (serpentine scan)
+    DITHER_ORDERED_BAYER,                   // Ordered dithering, 8x8 Bayer matrix
+    DITHER_ORDERED_BLUE_NOISE               // Ordered dithering, 32x32 blue noise mask (no visible pattern)
+} DitherMethod;
+
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, requires external shader
+    FONT_MSDF                       // MSDF font generation (multi-channel, RGB), requires MSDF shader: LoadFontShaderMSDF()
 } FontType;
 
+// Text alignment (TextBox lines)
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,            // Lines aligned to the left
+    TEXT_ALIGN_CENTER,              // Lines centered in text box width
+    TEXT_ALIGN_RIGHT                // Lines aligned to the right
+} TextAlignment;
+
 // Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
@@ -1243,10 +1396,44 @@ RLAPI Image LoadImageAnim(const char *fileName, int *frames);
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
+RLAPI Image *LoadImages(const char **fileNames, int count, int maxInFlight);                             // Load multiple images from files (multithreaded, in order), at most maxInFlight decoded at once (0 for all threads)
+RLAPI Image *LoadImagesFromMemory(const char **fileTypes, const unsigned char **fileData, const int *dataSizes, int count, int maxInFlight); // Load multiple images from memory buffers (multithreaded, in order)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI void UnloadImages(Image *images, int count);                                                       // Unload images loaded with LoadImages() or LoadImagesFromMemory()
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
+RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer (.png, .qoi), memory must be freed with MemFree()
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI void SetPngCompressionLevel(int level);                                                            // Set PNG export compression level (PngCompressionLevel)
+
+// Image scratch memory functions
+// NOTE: Transient buffers used by image processing functions are allocated from scratch arena if set,
+// heap is used when arena is disabled or full, arena must be disabled (size 0) to release its memory
+RLAPI bool SetImageScratchArena(int size);                                                               // Set image scratch arena size for transient buffers, 0 to disable (no transient buffers in use)
+RLAPI ImageScratchStats GetImageScratchStats(void);                                                      // Get image transient memory stats (scratch arena and heap)
+RLAPI void ResetImageScratchStats(void);                                                                 // Reset image transient memory peaks and counters
+
+// Animated image streaming functions
+// NOTE: Frames are decoded one at a time into the same buffer, only GIF and APNG support multiple frames
+RLAPI AnimImage LoadAnimImage(const char *fileName);                                                     // Load animated image stream from file
+RLAPI AnimImage LoadAnimImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load animated image stream from memory buffer, fileType refers to extension: i.e. '.gif'
+RLAPI bool IsAnimImageReady(AnimImage anim);                                                             // Check if an animated image stream is ready
+RLAPI void UnloadAnimImage(AnimImage anim);                                                              // Unload animated image stream
+RLAPI bool UpdateAnimImage(AnimImage *anim);                                                             // Decode next frame into anim.image, returns false if last frame reached (not looping)
+RLAPI void SeekAnimImage(AnimImage *anim, int frame);                                                    // Seek animated image stream to a frame (decodes from first frame if required)
+
+// Tiled image loading functions
+// NOTE: PNG files are decoded by rows directly from file, only requested regions are kept in memory
+RLAPI TiledImage LoadTiledImage(const char *fileName, int checkpointRows);                                // Load tiled image source from file (no pixel data loaded)
+RLAPI bool IsTiledImageReady(TiledImage tiled);                                                          // Check if a tiled image source is ready
+RLAPI void UnloadTiledImage(TiledImage tiled);                                                           // Unload tiled image source
+RLAPI Image LoadImageFromTiled(TiledImage tiled, Rectangle rec, int scale);                              // Load image region from tiled image source, downscaled by an integer factor (box filter)
+
+// Image import cache functions
+// NOTE: Processed images are stored as KTX files named by source content hash, ready to upload
+RLAPI void SetTextureImportCache(const char *dirPath, int format, unsigned int flags);                   // Set import cache directory and processing used by LoadTexture() (NULL to disable)
+RLAPI Image LoadImageImported(const char *fileName, int format, unsigned int flags);                     // Load image processed (format, TextureImportFlags), through import cache if set
+RLAPI int ImportImageDirectory(const char *dirPath, const char *filter, int format, unsigned int flags);  // Import directory images into import cache (multithreaded), returns imported files count
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1256,6 +1443,7 @@ RLAPI Image GenImageGradientRadial(int width, int height, float density, Color i
 RLAPI Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2);    // Generate image: checked
 RLAPI Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
+RLAPI Image GenImageFractalNoise(int width, int height, int offsetX, int offsetY, float scale, int octaves, float lacunarity, float gain, int seed); // Generate image: fractal noise (perlin octaves), seeded
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
@@ -1268,6 +1456,7 @@ RLAPI void ImageFormat(Image *image, int newFormat);
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
+RLAPI void ImageAlphaCropBatch(Image *images, int count, float threshold);                                // Crop multiple images depending on alpha value (multithreaded)
 RLAPI void ImageAlphaClear(Image *image, Color color, float threshold);                                  // Clear alpha channel to desired color
 RLAPI void ImageAlphaMask(Image *image, Image alphaMask);                                                // Apply alpha mask to image
 RLAPI void ImageAlphaPremultiply(Image *image);                                                          // Premultiply alpha channel
@@ -1277,23 +1466,36 @@ RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageDitherEx(Image *image, int newFormat, int method);                                       // Dither image data to pixel format, using DitherMethod (uncompressed formats)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
 RLAPI void ImageRotateCCW(Image *image);                                                                 // Rotate image counter-clockwise 90deg
+RLAPI void ImageTransform(Image *image, int transform);                                                  // Apply orientation transform to image (ImageTransformType), in place when possible
 RLAPI void ImageColorTint(Image *image, Color color);                                                    // Modify image color: tint
 RLAPI void ImageColorInvert(Image *image);                                                               // Modify image color: invert
 RLAPI void ImageColorGrayscale(Image *image);                                                            // Modify image color: grayscale
 RLAPI void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RLAPI void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
+RLAPI void ImageColorAdjust(Image *image, float grayscale, Color tint, float contrast, int brightness);  // Modify image color: grayscale (0.0f to 1.0f), tint, contrast and brightness in one pass
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
+RLAPI void GetImageAlphaBorders(Image image, Rectangle *recs, int count, float threshold);                // Get alpha border rectangles of multiple image regions, i.e. sprite sheet frames (multithreaded)
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image view functions
+// NOTE: Views reference source image pixel data, source image must be kept loaded while views are used
+RLAPI ImageView GetImageView(Image image, Rectangle rec);                                               // Get image view of a rectangle (clamped to image bounds), no pixel data copied
+RLAPI ImageView GetImageSubView(ImageView view, Rectangle rec);                                         // Get image view of a rectangle within another view
+RLAPI Image ImageFromView(ImageView view);                                                               // Create an image from image view (pixel data copied)
+RLAPI Color *LoadImageViewColors(ImageView view);                                                        // Load color data from image view as a Color array (RGBA - 32bit)
+RLAPI Rectangle GetImageViewAlphaBorder(ImageView view, float threshold);                               // Get image view alpha border rectangle
+RLAPI Color GetImageViewColor(ImageView view, int x, int y);                                            // Get image view pixel color at (x, y) position
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1301,15 +1503,21 @@ RLAPI void ImageDrawPixel(Image *dst, int posX, int posY, Color color);
 RLAPI void ImageDrawPixelV(Image *dst, Vector2 position, Color color);                                   // Draw pixel within an image (Vector version)
 RLAPI void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color); // Draw line within an image
 RLAPI void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color);                          // Draw line within an image (Vector version)
+RLAPI void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, Color color);                         // Draw antialiased line within an image (alpha blended)
 RLAPI void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color);               // Draw a filled circle within an image
 RLAPI void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color);                        // Draw a filled circle within an image (Vector version)
+RLAPI void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color);                     // Draw an antialiased filled circle within an image (alpha blended)
 RLAPI void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color);          // Draw circle outline within an image
 RLAPI void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color);                   // Draw circle outline within an image (Vector version)
 RLAPI void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color);       // Draw rectangle within an image
 RLAPI void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color);                 // Draw rectangle within an image (Vector version)
 RLAPI void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);                                // Draw rectangle within an image
 RLAPI void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color);                   // Draw rectangle lines within an image
+RLAPI void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);               // Draw triangle within an image
+RLAPI void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);          // Draw triangle outline within an image
+RLAPI void ImageDrawPolygon(Image *dst, Vector2 *points, int pointCount, Color color);                   // Draw polygon within an image (concave and self-intersecting supported)
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
+RLAPI void ImageDrawView(Image *dst, ImageView src, Rectangle dstRec, Color tint);                       // Draw a source image view within a destination image (tint applied to source)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
@@ -1325,6 +1533,17 @@ RLAPI bool IsRenderTextureReady(RenderTexture2D target);
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI void UpdateTextureRecView(Texture2D texture, Rectangle rec, ImageView view);                      // Update GPU texture rectangle with image view data (same pixel format)
+
+// Stream texture functions
+// NOTE: Stream textures are uploaded asynchronously through pixel buffers (if supported)
+RLAPI StreamTexture LoadStreamTexture(int width, int height, int format);                               // Load texture for streaming updates (uncompressed formats only)
+RLAPI bool IsStreamTextureReady(StreamTexture stream);                                                   // Check if a stream texture is ready
+RLAPI void UnloadStreamTexture(StreamTexture stream);                                                    // Unload stream texture from GPU memory (VRAM)
+RLAPI void *LockStreamTexture(StreamTexture *stream, Rectangle rec);                                     // Lock stream texture rectangle for writing, returns pixel data to fill (rows packed)
+RLAPI void UnlockStreamTexture(StreamTexture *stream);                                                   // Unlock stream texture, locked rectangle is uploaded
+RLAPI void SetStreamTextureDirty(StreamTexture *stream, Rectangle rec);                                  // Set stream texture rectangle as modified, uploaded on next update
+RLAPI void UpdateStreamTexture(StreamTexture *stream, const void *pixels);                               // Update stream texture dirty rectangles from pixel data (texture size and format)
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1366,9 +1585,13 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int pageSize, int maxPages);  // Load dynamic font from file, glyphs rasterized on demand into a glyph cache of atlas pages
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI FontCacheStats GetFontCacheStats(Font font);                                          // Get dynamic font glyph cache stats (hits, misses, evictions)
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type); // Load font data for further use
-RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
+RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info (NOTE: packMethod deprecated, ignored)
+RLAPI Shader LoadFontShaderMSDF(void);                                                      // Load default MSDF font shader, required to draw FONT_MSDF fonts
 RLAPI void UnloadFontData(GlyphInfo *chars, int glyphCount);                                // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
@@ -1381,12 +1604,31 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs resolved and positioned once to be drawn many times
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(Font font, TextLayout layout, Vector2 position, Color tint);      // Draw text layout (same font used to load it), glyphs drawn in one batch
+RLAPI void SetTextLayoutCache(int capacity);                                                // Set text layouts cache capacity, DrawTextEx()/MeasureTextEx() reuse cached layouts (0 to disable, default)
+RLAPI TextLayoutCacheStats GetTextLayoutCacheStats(void);                                   // Get text layouts cache stats (hits, misses, evictions)
+RLAPI void SetTextLineSpacingFactor(float factor);                                          // Set text line spacing factor, line height relative to font size (1.5 by default)
+
+// Text box functions (word-wrapping)
+RLAPI TextBox LoadTextBox(Font font, const char *text, float fontSize, float spacing, float width); // Load text box, text wrapped to width (0 for no wrapping), line breaks cached
+RLAPI void UnloadTextBox(TextBox box);                                                      // Unload text box data
+RLAPI void SetTextBoxText(TextBox *box, const char *text);                                  // Set text box text, all lines are wrapped
+RLAPI void AppendTextBoxText(TextBox *box, const char *text);                               // Append text to text box, only last paragraph lines are wrapped again
+RLAPI void SetTextBoxWidth(TextBox *box, float width);                                      // Set text box wrap width, all lines are wrapped
+RLAPI Vector2 MeasureTextBox(TextBox box);                                                  // Measure text box size (all lines)
+RLAPI void DrawTextBox(TextBox box, Vector2 position, Color tint);                          // Draw text box lines (from firstLine, up to maxLines), aligned, with ellipsis if text continues
+
 // Text font info functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                   // Get kerning advance between two codepoints (pixels at font base size), 0 if no kerning
+RLAPI void SetTextKerning(bool enabled);                                                    // Set text kerning (font kerning pairs applied on text drawing and measuring), enabled by default
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
@@ -1401,6 +1643,7 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);        // Encod
 
 // Text strings management functions (no UTF-8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
+// NOTE: Returned static strings use per-thread buffers, *Buffer() functions write to provided buffer (truncated to fit)
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
@@ -1416,6 +1659,13 @@ RLAPI const char *TextToUpper(const char *text);                      // Get upp
 RLAPI const char *TextToLower(const char *text);                      // Get lower case version of provided string
 RLAPI const char *TextToPascal(const char *text);                     // Get Pascal case notation version of provided string
 RLAPI int TextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
+RLAPI int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);           // Text formatting with variables into buffer, returns text length
+RLAPI int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length); // Get a piece of a text string into buffer, returns piece length
+RLAPI int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter); // Join text strings with delimiter into buffer, returns text length
+RLAPI int TextSplitSpans(const char *text, char delimiter, TextSpan *spans, int maxCount);  // Split text into substrings spans (no copy), returns spans count
+RLAPI int TextToUpperBuffer(char *buffer, int bufferSize, const char *text);                // Get upper case version of provided string into buffer, returns text length
+RLAPI int TextToLowerBuffer(char *buffer, int bufferSize, const char *text);                // Get lower case version of provided string into buffer, returns text length
+RLAPI int TextToPascalBuffer(char *buffer, int bufferSize, const char *text);               // Get Pascal case notation version of provided string into buffer, returns text length
 
 //------------------------------------------------------------------------------------
 // Basic 3d Shapes Drawing Functions (Module: models)
@@ -77,6 +77,10 @@
 *   #define SUPPORT_GIF_RECORDING
 *       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 *
+*   #define SUPPORT_ASYNC_SCREEN_CAPTURE
+*       Capture screenshots and GIF frames asynchronously, screen readback is resolved some frames later (OpenGL 3.3+)
+*       and images encoding and saving is done on background worker thread, TakeScreenshot() returns immediately
+*
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
 *       provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
@@ -154,6 +158,9 @@
 
     #define SDEFL_IMPLEMENTATION
     #include "external/sdefl.h"     // Deflate (RFC 1951) compressor
+
+    #define RL_SDEFL_IMPLEMENTATION
+    #include "external/rl_sdefl.h"  // Deflate stream parts compressor, required by sdefl internals
 #endif
 
 #if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
@@ -359,6 +366,12 @@
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
 
+#ifndef MAX_SCREEN_CAPTURES
+    #define MAX_SCREEN_CAPTURES            4        // Maximum screen captures waiting for readback (async capture)
+#endif
+
+#define SCREEN_CAPTURE_FRAME_DELAY         2        // Frames to wait before resolving a screen capture readback
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -531,6 +544,28 @@ typedef struct CoreData {
     } Time;
 } CoreData;
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Screen capture type
+typedef enum {
+    SCREEN_CAPTURE_IMAGE = 0,       // Screenshot, saved to file
+    SCREEN_CAPTURE_GIF_BEGIN,       // GIF recording begin
+    SCREEN_CAPTURE_GIF_FRAME,       // GIF recording frame
+    SCREEN_CAPTURE_GIF_END          // GIF recording end, saved to file
+} ScreenCaptureType;
+
+// Screen capture, waiting for screen readback or queued for processing
+typedef struct ScreenCapture {
+    ScreenCaptureType type;         // Capture type
+    unsigned int bufferId;          // Screen readback buffer id (0 if pixels already available)
+    unsigned int frame;             // Frame when screen readback was started
+    unsigned char *pixels;          // Screen pixels (R8G8B8A8)
+    int width;                      // Screen pixels width
+    int height;                     // Screen pixels height
+    char fileName[MAX_FILEPATH_LENGTH];     // Output file path
+    char fileType[8];               // Output file type, only if supported by ExportImageToMemory()
+} ScreenCapture;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -548,6 +583,11 @@ static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static ScreenCapture *screenCaptures[MAX_SCREEN_CAPTURES] = { 0 };  // Screen captures waiting for readback (in order)
+static int screenCaptureCount = 0;          // Screen captures waiting count
+#endif
+
 #if defined(PLATFORM_NX)
     s32 prev_touchcount = 0;
 #endif
@@ -659,6 +699,12 @@ static void SetupViewport(int width, int height);       // Set viewport for a pr
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static void QueueScreenCapture(ScreenCaptureType type, const char *fileName);  // Start screen capture, readback resolved some frames later
+static void ResolveScreenCaptures(bool wait);           // Resolve screen captures readback, queue them for processing
+static void ProcessScreenCapture(void *userData);       // Process screen capture (background worker thread task)
+#endif
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
 // Window callbacks events
@@ -979,6 +1025,12 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // Finish all screen captures (files saved) before closing
+    ResolveScreenCaptures(true);
+    WaitWorkerTasks();
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
@@ -2188,6 +2240,10 @@ void EndDrawing(void)
         // NOTE: We record one gif frame every 10 game frames
         if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
         {
+        #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+            // Start frame readback, frame is added to GIF on background worker thread
+            QueueScreenCapture(SCREEN_CAPTURE_GIF_FRAME, NULL);
+        #else
             // Get image data for the current frame (from backbuffer)
             // NOTE: This process is quite slow... :(
             Vector2 scale = GetWindowScaleDPI();
@@ -2195,6 +2251,7 @@ void EndDrawing(void)
             msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
 
             RL_FREE(screenData);    // Free image data
+        #endif
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -2209,6 +2266,10 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    ResolveScreenCaptures(false);   // Resolve completed screen readbacks (no GPU stall)
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     // Draw record/play indicator
     if (eventsRecording)
@@ -2957,16 +3018,20 @@ void SetConfigFlags(unsigned int flags)
 // NOTE TRACELOG() function is located in [utils.h]
 
 // Takes a screenshot of current screen (saved a .png)
+// NOTE: With SUPPORT_ASYNC_SCREEN_CAPTURE, screenshot is saved some frames later, on background worker thread
 void TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
+    char path[2048] = { 0 };
+    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    QueueScreenCapture(SCREEN_CAPTURE_IMAGE, path);
+#else
     Vector2 scale = GetWindowScaleDPI();
     unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
     Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-    char path[2048] = { 0 };
-    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
-
     ExportImage(image, path);           // WARNING: Module required: rtextures
     RL_FREE(imgData);
 
@@ -2977,6 +3042,7 @@ void TakeScreenshot(const char *fileName)
 #endif
 
     TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+#endif
 #else
     TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
 #endif
@@ -5705,6 +5771,135 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *fi
     else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
 }
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Start screen capture, screen readback is resolved some frames later by ResolveScreenCaptures()
+// NOTE: If pixel pack buffers are not supported, screen is read synchronously
+static void QueueScreenCapture(ScreenCaptureType type, const char *fileName)
+{
+    // NOTE: If captures queue is full, all captures are resolved (waiting for readback)
+    if (screenCaptureCount == MAX_SCREEN_CAPTURES) ResolveScreenCaptures(true);
+
+    ScreenCapture *capture = (ScreenCapture *)RL_CALLOC(1, sizeof(ScreenCapture));
+
+    Vector2 scale = GetWindowScaleDPI();
+    capture->type = type;
+    capture->frame = CORE.Time.frameCounter;
+    capture->width = (int)((float)CORE.Window.render.width*scale.x);
+    capture->height = (int)((float)CORE.Window.render.height*scale.y);
+
+    if (fileName != NULL)
+    {
+        strncpy(capture->fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+
+        // NOTE: Only file types supported by ExportImageToMemory() can be encoded on worker thread
+        if (IsFileExtension(fileName, ".png")) strcpy(capture->fileType, ".png");
+        else if (IsFileExtension(fileName, ".qoi")) strcpy(capture->fileType, ".qoi");
+    }
+
+    if ((type == SCREEN_CAPTURE_IMAGE) || (type == SCREEN_CAPTURE_GIF_FRAME))
+    {
+        capture->bufferId = rlReadScreenPixelsAsync(capture->width, capture->height);
+
+        if (capture->bufferId == 0) capture->pixels = rlReadScreenPixels(capture->width, capture->height);
+    }
+
+    screenCaptures[screenCaptureCount] = capture;
+    screenCaptureCount++;
+}
+
+// Resolve screen captures readback (in order), captures are queued to be processed on background worker thread
+// NOTE: If not waiting, only readbacks started SCREEN_CAPTURE_FRAME_DELAY frames ago are resolved (no GPU stall)
+static void ResolveScreenCaptures(bool wait)
+{
+    int resolved = 0;
+
+    for (; resolved < screenCaptureCount; resolved++)
+    {
+        ScreenCapture *capture = screenCaptures[resolved];
+
+        if (capture->bufferId != 0)
+        {
+            if (!wait && ((CORE.Time.frameCounter - capture->frame) < SCREEN_CAPTURE_FRAME_DELAY)) break;
+
+            capture->pixels = rlReadScreenPixelsResolve(capture->bufferId, capture->width, capture->height);
+            capture->bufferId = 0;
+        }
+
+        // NOTE: ExportImage() is not thread-safe (file extension check), unsupported file types are processed here
+        if ((capture->type == SCREEN_CAPTURE_IMAGE) && (capture->fileType[0] == '\0')) ProcessScreenCapture(capture);
+        else QueueWorkerTask(ProcessScreenCapture, capture);
+    }
+
+    for (int i = resolved; i < screenCaptureCount; i++) screenCaptures[i - resolved] = screenCaptures[i];
+    screenCaptureCount -= resolved;
+}
+
+// Process screen capture: encode and save screenshot or update GIF recording
+// NOTE: Runs on background worker thread, GIF recording state is only accessed from here while recording
+static void ProcessScreenCapture(void *userData)
+{
+    ScreenCapture *capture = (ScreenCapture *)userData;
+
+    switch (capture->type)
+    {
+        case SCREEN_CAPTURE_IMAGE:
+        {
+        #if defined(SUPPORT_MODULE_RTEXTURES)
+            if (capture->pixels != NULL)
+            {
+                Image image = { capture->pixels, capture->width, capture->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                bool success = false;
+
+                if (capture->fileType[0] != '\0')
+                {
+                    int dataSize = 0;
+                    unsigned char *fileData = ExportImageToMemory(image, capture->fileType, &dataSize);   // WARNING: Module required: rtextures
+
+                    if (fileData != NULL) success = SaveFileData(capture->fileName, fileData, dataSize);
+                    RL_FREE(fileData);
+                }
+                else success = ExportImage(image, capture->fileName);   // WARNING: Module required: rtextures
+
+            #if defined(PLATFORM_WEB)
+                // Download file from MEMFS (emscripten memory filesystem)
+                // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(capture->fileName), GetFileName(capture->fileName)));
+            #endif
+
+                if (success) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", capture->fileName);
+            }
+        #endif
+        } break;
+    #if defined(SUPPORT_GIF_RECORDING)
+        case SCREEN_CAPTURE_GIF_BEGIN: msf_gif_begin(&gifState, capture->width, capture->height); break;
+        case SCREEN_CAPTURE_GIF_FRAME:
+        {
+            if (capture->pixels != NULL) msf_gif_frame(&gifState, capture->pixels, 10, 16, capture->width*4);
+        } break;
+        case SCREEN_CAPTURE_GIF_END:
+        {
+            MsfGifResult result = msf_gif_end(&gifState);
+
+            SaveFileData(capture->fileName, result.data, (unsigned int)result.dataSize);
+            msf_gif_free(result);
+
+        #if defined(PLATFORM_WEB)
+            // Download file from MEMFS (emscripten memory filesystem)
+            // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
+            emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(capture->fileName), GetFileName(capture->fileName)));
+        #endif
+
+            TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+        } break;
+    #endif
+        default: break;
+    }
+
+    RL_FREE(capture->pixels);
+    RL_FREE(capture);
+}
+#endif
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 // GLFW3 Error Callback, runs on GLFW3 error
 static void ErrorCallback(int error, const char *description)
@@ -5807,6 +6002,10 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
             {
                 gifRecording = false;
 
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                // NOTE: GIF is saved on background worker thread, once all recorded frames are processed
+                QueueScreenCapture(SCREEN_CAPTURE_GIF_END, TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
+            #else
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
@@ -5819,14 +6018,19 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
             #endif
 
                 TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+            #endif
             }
             else
             {
                 gifRecording = true;
                 gifFrameCounter = 0;
 
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                QueueScreenCapture(SCREEN_CAPTURE_GIF_BEGIN, NULL);
+            #else
                 Vector2 scale = GetWindowScaleDPI();
                 msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+            #endif
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -7667,7 +7871,7 @@ static void PlayAutomationEvent(unsigned int frame)
 
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times (in same thread)
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -7678,11 +7882,11 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    // NOTE: Buffers are per-thread, vsnprintf() always writes '\0', buffer is not cleared
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
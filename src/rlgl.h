@@ -690,12 +690,20 @@ RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int fo
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer);               // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);                        // Load texture cubemap
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture with new data
+RLAPI void rlUpdateTextureStride(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data, int stride);  // Update GPU texture with new data, source rows separated by stride bytes
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlReadScreenPixelsAsync(int width, int height);       // Start screen pixel data readback into a pixel pack buffer, returns 0 if not supported
+RLAPI unsigned char *rlReadScreenPixelsResolve(unsigned int bufferId, int width, int height); // Get screen pixel data from readback buffer (unloaded), waits if not completed
+RLAPI unsigned int rlLoadPixelBuffer(int size);                          // Load pixel unpack buffer for streaming texture updates, returns 0 if not supported
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size);                 // Map pixel unpack buffer for writing, previous buffer data is discarded
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                          // Unmap pixel unpack buffer, written data is flushed
+RLAPI void rlUpdateTextureFromPixelBuffer(unsigned int id, unsigned int bufferId, int offsetX, int offsetY, int width, int height, int format, int bufferOffset);  // Update GPU texture with pixel unpack buffer data
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                         // Unload pixel unpack buffer
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -1050,6 +1058,7 @@ static char *rlGetCompressedFormatName(int format); // Get compressed format off
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlCopyScreenPixels(unsigned char *dst, const unsigned char *src, int width, int height);  // Copy screen pixels flipped vertically (alpha = 255)
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -3187,6 +3196,39 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
+// Update GPU texture with new data, source rows separated by stride bytes
+// NOTE: Stride is set as unpack row length if supported, otherwise rows are packed into a temporal buffer
+void rlUpdateTextureStride(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data, int stride)
+{
+    int rowSize = rlGetPixelDataSize(width, 1, format);
+
+    if ((stride == 0) || (stride == rowSize) || (height == 1) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        rlUpdateTexture(id, offsetX, offsetY, width, height, format, data);
+        return;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    int pixelSize = rowSize/width;
+
+    if ((stride%pixelSize) == 0)
+    {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, stride/pixelSize);
+        rlUpdateTexture(id, offsetX, offsetY, width, height, format, data);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        return;
+    }
+#endif
+
+    unsigned char *buffer = (unsigned char *)RL_MALLOC(rowSize*height);
+
+    for (int y = 0; y < height; y++) memcpy(buffer + y*rowSize, (const unsigned char *)data + y*stride, rowSize);
+
+    rlUpdateTexture(id, offsetX, offsetY, width, height, format, buffer);
+
+    RL_FREE(buffer);
+}
+
 // Get OpenGL internal formats and data type from raylib PixelFormat
 void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
@@ -3351,24 +3393,127 @@ unsigned char *rlReadScreenPixels(int width, int height)
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
     glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
 
-    // Flip image vertically!
     unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    rlCopyScreenPixels(imgData, screenData, width, height);
+
+    RL_FREE(screenData);
 
-    for (int y = height - 1; y >= 0; y--)
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Start screen pixel data readback into a pixel pack buffer
+// NOTE: Readback runs asynchronously on GPU, data must be retrieved with rlReadScreenPixelsResolve(),
+// ideally one or two frames later to avoid a pipeline stall
+unsigned int rlReadScreenPixelsAsync(int width, int height)
+{
+    unsigned int bufferId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &bufferId);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, bufferId);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width*height*4, NULL, GL_STREAM_READ);
+
+    // NOTE: Data pointer is an offset into the bound pixel pack buffer
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return bufferId;
+}
+
+// Get screen pixel data from readback buffer, buffer is unloaded
+// NOTE: Waits for readback completion if required, image data should be freed
+unsigned char *rlReadScreenPixelsResolve(unsigned int bufferId, int width, int height)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, bufferId);
+
+    unsigned char *screenData = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, width*height*4, GL_MAP_READ_BIT);
+
+    if (screenData != NULL)
     {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+        imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+        rlCopyScreenPixels(imgData, screenData, width, height);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
-        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
     }
+    else TRACELOG(RL_LOG_WARNING, "GL: Failed to map pixel pack buffer [ID %i]", bufferId);
 
-    RL_FREE(screenData);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glDeleteBuffers(1, &bufferId);
+#endif
 
-    return imgData;     // NOTE: image data should be freed
+    return imgData;
+}
+
+// Load pixel unpack buffer for streaming texture updates
+// NOTE: Texture uploads from a pixel unpack buffer are asynchronous, CPU does not wait
+// for driver to copy client memory as it happens with rlUpdateTexture()
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int bufferId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &bufferId);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, bufferId);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif
+
+    return bufferId;
+}
+
+// Map pixel unpack buffer for writing
+// NOTE: Previous buffer data is invalidated, so driver does not need to wait
+// for pending uploads using the buffer (it can provide a new memory block)
+void *rlMapPixelBuffer(unsigned int id, int size)
+{
+    void *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
+    data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (data == NULL) TRACELOG(RL_LOG_WARNING, "GL: Failed to map pixel unpack buffer [ID %i]", id);
+#endif
+
+    return data;
+}
+
+// Unmap pixel unpack buffer
+void rlUnmapPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif
+}
+
+// Update GPU texture with pixel unpack buffer data
+// NOTE: Buffer must be unmapped, data rows are expected to be packed
+void rlUpdateTextureFromPixelBuffer(unsigned int id, unsigned int bufferId, int offsetX, int offsetY, int width, int height, int format, int bufferOffset)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, bufferId);
+
+    // NOTE: Data pointer is an offset into the bound pixel unpack buffer
+    rlUpdateTexture(id, offsetX, offsetY, width, height, format, (const void *)(size_t)bufferOffset);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif
+}
+
+// Unload pixel unpack buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
 }
 
 // Framebuffer management (fbo)
@@ -4650,6 +4795,19 @@ static char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Copy screen pixels (R8G8B8A8) flipped vertically, alpha set to 255
+// NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+static void rlCopyScreenPixels(unsigned char *dst, const unsigned char *src, int width, int height)
+{
+    for (int y = 0; y < height; y++)
+    {
+        unsigned char *row = dst + (height - 1 - y)*width*4;
+        memcpy(row, src + y*width*4, width*4);
+
+        for (int x = 3; x < width*4; x += 4) row[x] = 255;
+    }
+}
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
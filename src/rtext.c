@@ -58,7 +58,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
-#include "utils.h"          // Required for: LoadFile*()
+#include "utils.h"          // Required for: LoadFile*(), RunWorkerItems()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
 #include <stdlib.h>         // Required for: malloc(), free()
@@ -89,11 +89,168 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef TEXT_DECODE_CHUNK_SIZE
+    #define TEXT_DECODE_CHUNK_SIZE               256        // Codepoints decoded per chunk on text drawing and measuring (stack array)
+#endif
+
+#define GLYPH_LOOKUP_PAGE_BITS                     8        // Glyph lookup page size (codepoints), as bits shift: 256 codepoints
+#define GLYPH_LOOKUP_PAGE_SIZE      (1 << GLYPH_LOOKUP_PAGE_BITS)
+
+#ifndef FONT_KERNING_MAX_PAIR_GLYPHS
+    #define FONT_KERNING_MAX_PAIR_GLYPHS        1024        // Maximum font glyphs queried for kerning pairs (GPOS fonts), first glyphs are used
+#endif
+#define KERNING_PAIR_EMPTY                0xffffffff        // Kerning table empty entry key
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE) && !defined(SUPPORT_FILEFORMAT_TTF)
+    #undef SUPPORT_FONT_GLYPH_CACHE                         // Glyph cache rasterizes glyphs from TTF/OTF font data
+#endif
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+#ifndef GLYPH_CACHE_DEFAULT_PAGE_SIZE
+    #define GLYPH_CACHE_DEFAULT_PAGE_SIZE        512        // Glyph cache default atlas page size (width and height)
+#endif
+#ifndef GLYPH_CACHE_DEFAULT_MAX_PAGES
+    #define GLYPH_CACHE_DEFAULT_MAX_PAGES          4        // Glyph cache default atlas pages limit
+#endif
+#ifndef GLYPH_CACHE_MAX_EMPTY_GLYPHS
+    #define GLYPH_CACHE_MAX_EMPTY_GLYPHS         128        // Glyph cache slots reserved for glyphs with no pixels (spaces)
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+// Glyph cache atlas page
+typedef struct GlyphCachePage {
+    Image image;                // Page atlas image (GRAY_ALPHA), glyphs rasterized into it
+    Texture2D texture;          // Page atlas texture, updated with dirty region before drawing
+    stbrp_context packer;       // Page skyline packer
+    stbrp_node *nodes;          // Page skyline packer nodes
+    Rectangle dirty;            // Page region modified since last texture update
+    int glyphCount;             // Glyphs cached in page
+    unsigned int lastUse;       // Page last use stamp, least recently used page is evicted first
+} GlyphCachePage;
+
+// Glyph cache for dynamic fonts
+// NOTE: Font glyphs and recs are fixed arrays of cache slots, so Font copies keep pointing to valid data
+typedef struct GlyphCache {
+    unsigned char *fileData;    // Font file data (copy), required to rasterize glyphs on demand
+    stbtt_fontinfo fontInfo;    // Font info for stb_truetype
+    float scaleFactor;          // Font scale factor for base size
+    int ascent;                 // Font ascent, scaled to base size
+
+    GlyphCachePage *pages;      // Atlas pages
+    int pageCount;              // Atlas pages loaded
+    int maxPages;               // Atlas pages limit
+    int pageSize;               // Atlas page size (width and height)
+
+    GlyphInfo *glyphs;          // Font glyphs slots (font.glyphs)
+    Rectangle *recs;            // Font glyphs atlas rectangles slots (font.recs)
+    int slotCount;              // Glyphs slots count (font.glyphCount)
+    int *slotPages;             // Atlas page for every slot, -1 for glyphs with no pixels, -2 for free slots
+    int *freeSlots;             // Free slots stack
+    int freeCount;              // Free slots count
+    int *table;                 // Codepoint to slot hash table (open addressing), -1 for empty entries
+    int tableSize;              // Hash table size (power of two)
+
+    unsigned int useCounter;    // Use stamp counter
+    FontCacheStats stats;       // Cache stats
+} GlyphCache;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job data (LoadFontData())
+typedef struct FontGlyphsJobData {
+    const stbtt_fontinfo *fontInfo; // Font info for stb_truetype (read only)
+    GlyphInfo *chars;           // Output glyphs
+    const int *fontChars;       // Glyphs codepoints
+    int fontSize;               // Font size (pixels height)
+    float scaleFactor;          // Font scale factor
+    int ascent;                 // Font ascent (unscaled)
+    int type;                   // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF
+} FontGlyphsJobData;
+
+// MSDF glyph outline edge (line, quadratic or cubic bezier), in glyph image pixel space
+typedef struct MsdfEdge {
+    Vector2 p[4];               // Edge control points
+    int pointCount;             // Edge control points count: 2-Line, 3-Quadratic bezier, 4-Cubic bezier
+    int color;                  // Edge color, channels mask: 1-Red, 2-Green, 4-Blue
+} MsdfEdge;
+
+// MSDF signed distance to an edge
+typedef struct MsdfDistance {
+    float distance;             // Signed distance
+    float dot;                  // Alignment with edge direction, breaks ties between edges sharing an endpoint
+} MsdfDistance;
+#endif
+
+// Text layouts cache entry
+typedef struct TextLayoutCacheEntry {
+    unsigned int hash;          // Text and layout parameters hash
+    char *text;                 // Text copy (key)
+    int textSize;               // Text size in bytes (key)
+    const GlyphInfo *glyphs;    // Font glyphs, font identity (key)
+    unsigned int textureId;     // Font texture id, font identity (key)
+    float fontSize;             // Font size (key)
+    float spacing;              // Glyphs spacing (key)
+    TextLayout layout;          // Cached text layout
+    int prev;                   // Previous entry in LRU list (more recently used), -1 for head
+    int next;                   // Next entry in LRU list (less recently used), -1 for tail
+    int chain;                  // Next entry in hash bucket chain, -1 for last
+} TextLayoutCacheEntry;
+
+// Text layouts cache, least recently used layouts are evicted when full
+typedef struct TextLayoutCache {
+    TextLayoutCacheEntry *entries;  // Cache entries
+    int *buckets;               // Hash buckets, first entry of every chain, -1 for empty buckets
+    int bucketCount;            // Hash buckets count (power of two)
+    int count;                  // Cache entries used
+    int head;                   // Most recently used entry
+    int tail;                   // Least recently used entry
+    TextLayoutCacheStats stats; // Cache stats
+} TextLayoutCache;
+
+// Font kerning pair
+typedef struct KerningPair {
+    unsigned int key;           // Glyphs indices pair: (index << 16) | nextIndex, KERNING_PAIR_EMPTY for empty entries
+    float advance;              // Kerning advance (pixels at font base size)
+} KerningPair;
+
+// Font kerning pairs table (font.kerning), hash table allocated in the same memory block
+typedef struct KerningTable {
+    int pairCount;              // Kerning pairs count
+    int tableSize;              // Hash table size (power of two)
+    KerningPair *pairs;         // Hash table entries (open addressing)
+} KerningTable;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font kerning pairs query job data (LoadFontKerning())
+typedef struct FontKerningJobData {
+    const stbtt_fontinfo *fontInfo; // Font info for stb_truetype (read only)
+    const int *glyphIds;        // Font glyphs TTF glyph ids (0 for missing glyphs)
+    int glyphCount;             // Font glyphs queried
+    float scaleFactor;          // Font scale factor
+    KerningPair *pairs;         // Output kerning pairs (shared, locked)
+    int pairCount;              // Output kerning pairs count
+    int pairCapacity;           // Output kerning pairs capacity
+} FontKerningJobData;
+#endif
+
+// Text box line, wrapped line range in text box text
+typedef struct TextBoxLine {
+    int start;                  // Line first byte in text
+    int end;                    // Line last byte in text (exclusive), trailing spaces and line break excluded
+    float width;                // Line width (pixels at text box font size)
+} TextBoxLine;
+
+// Text box lines data (box.lineData), cached line breaks
+typedef struct TextBoxData {
+    TextBoxLine *lines;         // Text box lines
+    int lineCapacity;           // Lines array capacity
+    int textCapacity;           // Text buffer capacity (bytes)
+    int paragraphLine;          // Last paragraph first line, appended text is wrapped from this line
+} TextBoxData;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -104,6 +261,10 @@
 static Font defaultFont = { 0 };
 #endif
 
+static TextLayoutCache textLayoutCache = { 0 };     // Text layouts cache, disabled by default (no capacity)
+static bool textKerning = true;                     // Text kerning enabled, font kerning pairs applied on text drawing and measuring
+static float textLineSpacingFactor = 1.5f;          // Text line spacing factor, line height relative to font size
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -115,11 +276,42 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);     // Load codepoint to glyph index lookup (pages table)
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint);  // Draw one glyph from its index in font
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphsJob(void *userData, int start, int end);  // Load font glyphs range data, rasterized on worker threads
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, float range, int *width, int *height, int *offsetX, int *offsetY); // Load glyph MSDF image data (RGB) from outline
+static void SetMsdfContourColors(MsdfEdge *edges, int *edgeCount, int start);   // Set MSDF contour edges colors, splitting edges if required
+static void SplitMsdfEdge(const MsdfEdge *edge, float t, MsdfEdge *left, MsdfEdge *right);  // Split MSDF edge at parameter t (de Casteljau)
+static Vector2 GetMsdfEdgePoint(const MsdfEdge *edge, float t);     // Get MSDF edge point at parameter t
+static Vector2 GetMsdfEdgeDirection(const MsdfEdge *edge, float t); // Get MSDF edge direction at parameter t
+static MsdfDistance GetMsdfEdgeDistance(const MsdfEdge *edge, Vector2 origin, float *param);    // Get MSDF signed distance from point to edge
+static int SolveMsdfCubic(float *x, float a, float b, float c, float d);    // Solve cubic equation, returns solutions count
+#endif
+static TextLayout *GetTextLayoutCached(Font font, const char *text, float fontSize, float spacing); // Get text layout from cache, laid out on a miss
+static void ClearTextLayoutCache(void);                             // Clear text layouts cache entries (capacity and stats kept)
+static float GetKerningAdvance(const void *kerning, int index, int nextIndex);  // Get kerning advance for a glyphs indices pair (pixels at font base size)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void *LoadFontKerning(const unsigned char *fileData, const GlyphInfo *glyphs, int glyphCount, int fontSize);  // Load font kerning pairs table from TTF/OTF data, NULL if no pairs
+static void LoadFontKerningJob(void *userData, int start, int end); // Load font kerning pairs for glyphs range, queried on worker threads
+#endif
+static void WrapTextBoxLines(TextBox *box, int firstLine);           // Wrap text box lines, from a paragraph first line to text end
+static int GetCodepointsNext(const char *text, int size, int *position, int *codepoints, int maxCount);  // Get next codepoints from UTF-8 text (up to maxCount), position moved, returns codepoints count
+static int GetTextAsciiLength(const char *text, int size);          // Get text ASCII bytes count from start (bytes < 0x80)
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+static int GetGlyphCacheIndex(GlyphCache *cache, int codepoint);    // Get glyph cache slot for codepoint, rasterizing glyph on a miss
+static Texture2D GetGlyphCacheTexture(GlyphCache *cache, int index);    // Get glyph cache page texture for a glyph slot, uploading page changes
+static void LoadGlyphCachePage(GlyphCache *cache);                  // Load a new empty atlas page into glyph cache
+static int LoadGlyphCacheRegion(GlyphCache *cache, int width, int height, Rectangle *rec);  // Load atlas region for a glyph, evicting least recently used page if required
+static void EvictGlyphCachePage(GlyphCache *cache, int page);       // Evict all glyphs from an atlas page (-1 for glyphs with no pixels)
+static void UnloadGlyphCache(GlyphCache *cache);                    // Unload glyph cache data and atlas pages
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
+extern float GetTextLineSpacingFactor(void);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -271,6 +463,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -282,6 +475,9 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphLookup);
+
+    ClearTextLayoutCache();     // Cached text layouts could use default font
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -487,6 +683,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -524,6 +721,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+            font.kerning = LoadFontKerning(fileData, font.glyphs, font.glyphCount, font.baseSize);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -535,6 +735,134 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load dynamic font from file, glyphs rasterized on demand into a glyph cache of atlas pages
+// NOTE: Use 0 for pageSize and maxPages to use default values
+Font LoadFontDynamic(const char *fileName, int fontSize, int pageSize, int maxPages)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    // Loading file to memory
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data, copied to be kept by glyph cache
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, pageSize, maxPages);
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+#else
+    TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic fonts not supported, SUPPORT_FONT_GLYPH_CACHE required", fileName);
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied and kept in memory to rasterize glyphs on first use,
+// glyphs are packed into atlas pages and the least recently used page is reused when cache is full
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((fileData != NULL) && (fontSize > 0) && (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        GlyphCache *cache = (GlyphCache *)RL_CALLOC(1, sizeof(GlyphCache));
+        cache->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(cache->fileData, fileData, dataSize);
+
+        if (stbtt_InitFont(&cache->fontInfo, cache->fileData, 0))
+        {
+            // Calculate font scale factor and baseline, same metrics as LoadFontData()
+            int ascent = 0, descent = 0, lineGap = 0;
+            stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+            cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+            cache->ascent = (int)((float)ascent*cache->scaleFactor);
+
+            int cellWidth = fontSize/2 + 2*FONT_TTF_DEFAULT_CHARS_PADDING;
+            int cellHeight = fontSize + 2*FONT_TTF_DEFAULT_CHARS_PADDING;
+
+            cache->pageSize = (pageSize > 0)? pageSize : GLYPH_CACHE_DEFAULT_PAGE_SIZE;
+            if (cache->pageSize < 2*cellHeight) cache->pageSize = 2*cellHeight;    // Room for glyphs taller than font size
+            cache->maxPages = (maxPages > 0)? maxPages : GLYPH_CACHE_DEFAULT_MAX_PAGES;
+            cache->pages = (GlyphCachePage *)RL_CALLOC(cache->maxPages, sizeof(GlyphCachePage));
+
+            // Glyphs slots: pages filled with half-width glyphs, plus glyphs with no pixels
+            cache->slotCount = cache->maxPages*(cache->pageSize/cellWidth)*(cache->pageSize/cellHeight) + GLYPH_CACHE_MAX_EMPTY_GLYPHS;
+            cache->glyphs = (GlyphInfo *)RL_CALLOC(cache->slotCount, sizeof(GlyphInfo));
+            cache->recs = (Rectangle *)RL_CALLOC(cache->slotCount, sizeof(Rectangle));
+            cache->slotPages = (int *)RL_MALLOC(cache->slotCount*sizeof(int));
+            cache->freeSlots = (int *)RL_MALLOC(cache->slotCount*sizeof(int));
+            cache->freeCount = cache->slotCount;
+
+            for (int i = 0; i < cache->slotCount; i++)
+            {
+                cache->slotPages[i] = -2;
+                cache->freeSlots[i] = cache->slotCount - 1 - i;     // Stack top is slot 0
+            }
+
+            cache->tableSize = 1;
+            while (cache->tableSize < 2*cache->slotCount) cache->tableSize <<= 1;
+            cache->table = (int *)RL_MALLOC(cache->tableSize*sizeof(int));
+            for (int i = 0; i < cache->tableSize; i++) cache->table[i] = -1;
+
+            LoadGlyphCachePage(cache);
+
+            font.baseSize = fontSize;
+            font.glyphCount = cache->slotCount;
+            font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            font.texture = cache->pages[0].texture;
+            font.recs = cache->recs;
+            font.glyphs = cache->glyphs;
+            font.glyphCache = cache;
+
+            TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %ix%i atlas pages | %i max pages)", fontSize, cache->pageSize, cache->pageSize, cache->maxPages);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+
+            RL_FREE(cache->fileData);
+            RL_FREE(cache);
+            font = GetFontDefault();
+        }
+    }
+    else font = GetFontDefault();
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts not supported, SUPPORT_FONT_GLYPH_CACHE required");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Get dynamic font glyph cache stats (hits, misses, evictions)
+// NOTE: Static fonts return empty stats
+FontCacheStats GetFontCacheStats(Font font)
+{
+    FontCacheStats stats = { 0 };
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL)
+    {
+        GlyphCache *cache = (GlyphCache *)font.glyphCache;
+
+        stats = cache->stats;
+        stats.pageCount = cache->pageCount;
+        stats.glyphCount = cache->slotCount - cache->freeCount;
+    }
+#endif
+
+    return stats;
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -549,7 +877,7 @@ bool IsFontReady(Font font)
 }
 
 // Load font data for further use
-// NOTE: Requires TTF font memory data and can generate SDF data
+// NOTE: Requires TTF font memory data and can generate SDF and MSDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type)
 {
     // NOTE: Using some SDF generation default values,
@@ -566,6 +894,15 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 #ifndef FONT_BITMAP_ALPHA_THRESHOLD
     #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
 #endif
+#ifndef FONT_MSDF_CHAR_PADDING
+    #define FONT_MSDF_CHAR_PADDING           4      // MSDF font generation char padding
+#endif
+#ifndef FONT_MSDF_PIXEL_RANGE
+    #define FONT_MSDF_PIXEL_RANGE          4.0f     // MSDF font generation distance range (pixels, inside to outside)
+#endif
+#ifndef FONT_MSDF_CORNER_ANGLE
+    #define FONT_MSDF_CORNER_ANGLE         3.0f     // MSDF font generation corner detection angle (radians), edges colors change at corners
+#endif
 
     GlyphInfo *chars = NULL;
 
@@ -600,69 +937,12 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                 genFontChars = true;
             }
 
-            chars = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
-
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < glyphCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
+            chars = (GlyphInfo *)RL_CALLOC(glyphCount, sizeof(GlyphInfo));   // Zero initialized, SDF space glyph offsets are not set
 
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .mipmaps = 1,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            // Rasterize glyphs on worker threads, glyphs are independent and one item is processed at a time
+            // NOTE: Every glyph is stored at its own index, output does not depend on threads scheduling
+            FontGlyphsJobData job = { &fontInfo, chars, fontChars, fontSize, scaleFactor, ascent, type };
+            RunWorkerItems(LoadFontGlyphsJob, &job, glyphCount, 0);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -674,10 +954,14 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Glyphs are always packed with Skyline rect packing, packMethod is deprecated and ignored,
+// fontSize is not required (atlas size is computed from glyphs images)
 #if defined(SUPPORT_FILEFORMAT_TTF)
 Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
+    (void)fontSize;
+    (void)packMethod;
+
     Image atlas = { 0 };
 
     if (chars == NULL)
@@ -694,133 +978,107 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
     // NOTE: Rectangles memory is loaded here!
     Rectangle *recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
 
-    // Calculate image size based on required pixel area
-    // NOTE 1: Image is forced to be squared and POT... very conservative!
-    // NOTE 2: SDF font characters already contain an internal padding,
-    // so image size would result bigger than default font type
-    float requiredArea = 0;
-    for (int i = 0; i < glyphCount; i++) requiredArea += ((chars[i].image.width + 2*padding)*(fontSize + 2*padding));
-    float guessSize = sqrtf(requiredArea)*1.4f;
-    int imageSize = (int)powf(2, ceilf(logf((float)guessSize)/logf(2)));    // Calculate next POT
-
-    atlas.width = imageSize;   // Atlas bitmap width
-    atlas.height = imageSize;  // Atlas bitmap height
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    atlas.mipmaps = 1;
+    // NOTE: All packing methods use Skyline rect packing algorithm (stb_rect_pack), rectangles sorted by height,
+    // basic packing (one char after another in fixed height rows) wasted too much atlas space
 
-    // DEBUG: We can see padding in the generated image setting a gray background...
-    //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
+    // Calculate atlas width from required pixel area, atlas height is adjusted to packed rectangles
+    // NOTE: SDF font characters already contain an internal padding, so they require more area than default font type
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+    int requiredArea = 0;
+    int maxWidth = 1;
+    int maxHeight = 1;
 
-    if (packMethod == 0)   // Use basic packing algorithm
+    for (int i = 0; i < glyphCount; i++)
     {
-        int offsetX = padding;
-        int offsetY = padding;
+        rects[i].id = i;
+        rects[i].w = chars[i].image.width + 2*padding;
+        rects[i].h = chars[i].image.height + 2*padding;
 
-        // NOTE: Using simple packaging, one char after another
-        for (int i = 0; i < glyphCount; i++)
-        {
-            // Copy pixel data from fc.data to atlas
-            for (int y = 0; y < chars[i].image.height; y++)
-            {
-                for (int x = 0; x < chars[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
-                }
-            }
+        requiredArea += rects[i].w*rects[i].h;
+        if (rects[i].w > maxWidth) maxWidth = rects[i].w;
+        maxHeight += rects[i].h;
+    }
 
-            // Fill chars rectangles in atlas info
-            recs[i].x = (float)offsetX;
-            recs[i].y = (float)offsetY;
-            recs[i].width = (float)chars[i].image.width;
-            recs[i].height = (float)chars[i].image.height;
+    // OpenGL 1.1 requires POT textures, the rest of OpenGL versions support NPOT textures without mipmaps (not required for fonts)
+    bool requirePOT = (rlGetVersion() == RL_OPENGL_11);
 
-            // Move atlas position X for next character drawing
-            offsetX += (chars[i].image.width + 2*padding);
+    atlas.width = (int)ceilf(sqrtf((float)requiredArea));
+    if (atlas.width < maxWidth) atlas.width = maxWidth;
+    if (requirePOT) atlas.width = (int)powf(2, ceilf(logf((float)atlas.width)/logf(2)));    // Calculate next POT
+    else atlas.width = (atlas.width + 3)/4*4;       // Keep rows 4-bytes aligned
 
-            if (offsetX >= (atlas.width - chars[i].image.width - 2*padding))
-            {
-                offsetX = padding;
+    // Package rectangles into atlas width, height is not limited (rectangles in one column at worst)
+    stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
+    stbrp_node *nodes = (stbrp_node *)RL_MALLOC(atlas.width*sizeof(*nodes));
 
-                // NOTE: Be careful on offsetY for SDF fonts, by default SDF
-                // use an internal padding of 4 pixels, it means char rectangle
-                // height is bigger than fontSize, it could be up to (fontSize + 8)
-                offsetY += (fontSize + 2*padding);
+    stbrp_init_target(context, atlas.width, maxHeight, nodes, atlas.width);
+    stbrp_pack_rects(context, rects, glyphCount);
 
-                if (offsetY > (atlas.height - fontSize - padding))
-                {
-                    for(int j = i + 1; j < glyphCount; j++)
-                    {
-                        TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", j);
-                        // make sure remaining recs contain valid data
-                        recs[j].x = 0;
-                        recs[j].y = 0;
-                        recs[j].width = 0;
-                        recs[j].height = 0;
-                    }
-                    break;
-                }
-            }
-        }
-    }
-    else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
-    {
-        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
+    atlas.height = 1;
+    for (int i = 0; i < glyphCount; i++) if (rects[i].was_packed && ((rects[i].y + rects[i].h) > atlas.height)) atlas.height = rects[i].y + rects[i].h;
+    if (requirePOT) atlas.height = (int)powf(2, ceilf(logf((float)atlas.height)/logf(2)));
+    else atlas.height = (atlas.height + 3)/4*4;
+
+    // Atlas pixel format from chars images: GRAYSCALE (converted to GRAY_ALPHA at the end) or R8G8B8 (MSDF font)
+    atlas.format = (chars[0].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    atlas.mipmaps = 1;
 
-        stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
-        stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+    int bytesPerPixel = (atlas.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 1;
+    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height*bytesPerPixel);   // Create a bitmap to store characters (8 bpp or 24 bpp)
 
-        // Fill rectangles for packaging
-        for (int i = 0; i < glyphCount; i++)
-        {
-            rects[i].id = i;
-            rects[i].w = chars[i].image.width + 2*padding;
-            rects[i].h = chars[i].image.height + 2*padding;
-        }
+    // DEBUG: We can see padding in the generated image setting a gray background...
+    //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
 
-        // Package rectangles into atlas
-        stbrp_pack_rects(context, rects, glyphCount);
+    int usedArea = 0;
 
-        for (int i = 0; i < glyphCount; i++)
-        {
-            // It returns char rectangles in atlas
-            recs[i].x = rects[i].x + (float)padding;
-            recs[i].y = rects[i].y + (float)padding;
-            recs[i].width = (float)chars[i].image.width;
-            recs[i].height = (float)chars[i].image.height;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        // It returns char rectangles in atlas
+        recs[i].x = rects[i].x + (float)padding;
+        recs[i].y = rects[i].y + (float)padding;
+        recs[i].width = (float)chars[i].image.width;
+        recs[i].height = (float)chars[i].image.height;
 
-            if (rects[i].was_packed)
+        if (rects[i].was_packed)
+        {
+            // Copy pixel data from fc.data to atlas, one row at a time
+            for (int y = 0; y < chars[i].image.height; y++)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < chars[i].image.height; y++)
-                {
-                    for (int x = 0; x < chars[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
-                    }
-                }
+                memcpy((unsigned char *)atlas.data + ((rects[i].y + padding + y)*atlas.width + rects[i].x + padding)*bytesPerPixel,
+                       (unsigned char *)chars[i].image.data + y*chars[i].image.width*bytesPerPixel, chars[i].image.width*bytesPerPixel);
             }
-            else TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
-        }
 
-        RL_FREE(rects);
-        RL_FREE(nodes);
-        RL_FREE(context);
+            usedArea += rects[i].w*rects[i].h;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
+            recs[i] = (Rectangle){ 0 };
+        }
     }
 
-    // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
+    RL_FREE(rects);
+    RL_FREE(nodes);
+    RL_FREE(context);
 
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    TRACELOG(LOG_INFO, "FONT: Image atlas generated (%ix%i | %i glyphs | %.1f%% occupancy)", atlas.width, atlas.height, glyphCount, 100.0f*usedArea/(atlas.width*atlas.height));
+
+    // Convert image data from GRAYSCALE to GRAY_ALPHA
+    // NOTE: MSDF atlas is kept as R8G8B8, alpha is computed by MSDF shader from channels median
+    if (atlas.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
+
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *charRecs = recs;
 
@@ -828,6 +1086,73 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
 }
 #endif
 
+// Load default MSDF font shader, required to draw FONT_MSDF fonts
+// NOTE: Alpha is computed from channels median distance, antialiased with screen-space derivatives at any scale
+Shader LoadFontShaderMSDF(void)
+{
+    // Fragment shaders directly defined, default vertex shader is used
+    static const char *msdfShaderCode330 =
+        "#version 330                       \n"
+        "in vec2 fragTexCoord;              \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "float median(float r, float g, float b) { return max(min(r, g), min(max(r, g), b)); } \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec3 msd = texture(texture0, fragTexCoord).rgb; \n"
+        "    float sd = median(msd.r, msd.g, msd.b) - 0.5; \n"
+        "    float alpha = clamp(sd/max(fwidth(sd), 0.0001) + 0.5, 0.0, 1.0); \n"
+        "    finalColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+        "}                                  \n";
+
+    static const char *msdfShaderCode120 =
+        "#version 120                       \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying vec4 fragColor;            \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "float median(float r, float g, float b) { return max(min(r, g), min(max(r, g), b)); } \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec3 msd = texture2D(texture0, fragTexCoord).rgb; \n"
+        "    float sd = median(msd.r, msd.g, msd.b) - 0.5; \n"
+        "    float alpha = clamp(sd/max(fwidth(sd), 0.0001) + 0.5, 0.0, 1.0); \n"
+        "    gl_FragColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+        "}                                  \n";
+
+    static const char *msdfShaderCode100 =
+        "#version 100                       \n"
+        "#extension GL_OES_standard_derivatives : enable \n"    // Required for fwidth() on OpenGL ES2 (WebGL)
+        "precision mediump float;           \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying vec4 fragColor;            \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "float median(float r, float g, float b) { return max(min(r, g), min(max(r, g), b)); } \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec3 msd = texture2D(texture0, fragTexCoord).rgb; \n"
+        "    float sd = median(msd.r, msd.g, msd.b) - 0.5; \n"
+        "    float alpha = clamp(sd/max(fwidth(sd), 0.0001) + 0.5, 0.0, 1.0); \n"
+        "    gl_FragColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+        "}                                  \n";
+
+    Shader shader = { 0 };
+
+    switch (rlGetVersion())
+    {
+        case RL_OPENGL_21: shader = LoadShaderFromMemory(0, msdfShaderCode120); break;
+        case RL_OPENGL_33:
+        case RL_OPENGL_43: shader = LoadShaderFromMemory(0, msdfShaderCode330); break;
+        case RL_OPENGL_ES_20: shader = LoadShaderFromMemory(0, msdfShaderCode100); break;
+        default: TRACELOG(LOG_WARNING, "FONT: MSDF shader not supported on OpenGL 1.1"); break;
+    }
+
+    return shader;
+}
+
 // Unload font glyphs info data (RAM)
 void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 {
@@ -846,8 +1171,24 @@ void UnloadFont(Font font)
     if (font.texture.id != GetFontDefault().texture.id)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+        if (font.glyphCache != NULL) UnloadGlyphCache((GlyphCache *)font.glyphCache);   // Unloads all atlas pages textures
+        else
+#endif
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphLookup);
+        RL_FREE(font.kerning);
+
+        // Cached text layouts for this font are no longer valid
+        for (int i = 0; i < textLayoutCache.count; i++)
+        {
+            if (textLayoutCache.entries[i].glyphs == font.glyphs)
+            {
+                ClearTextLayoutCache();
+                break;
+            }
+        }
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1045,43 +1386,56 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
+    // Draw cached text layout, if text layouts cache is enabled
+    if ((textLayoutCache.stats.capacity > 0) && (text != NULL))
+    {
+        DrawTextLayout(font, *GetTextLayoutCached(font, text, fontSize, spacing), position, tint);
+        return;
+    }
+
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int prevIndex = -1;             // Previous glyph index in line, for kerning
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    int codepoints[TEXT_DECODE_CHUNK_SIZE];             // Text codepoints, decoded by chunks (not cleared)
+
     for (int i = 0; i < size;)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
+        // Get next codepoints chunk from byte string, text bytes counter moved to next codepoint
+        // NOTE: Codepoints are decoded as GetCodepointNext(), ASCII bytes are decoded in blocks
+        int count = GetCodepointsNext(text, size, &i, codepoints, TEXT_DECODE_CHUNK_SIZE);
 
-        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all the bad bytes using the '?' symbol moving one byte
-        if (codepoint == 0x3f) codepointByteCount = 1;
-
-        if (codepoint == '\n')
-        {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
-            textOffsetX = 0.0f;
-        }
-        else
+        for (int c = 0; c < count; c++)
         {
-            if ((codepoint != ' ') && (codepoint != '\t'))
+            // Get glyph index in font
+            int codepoint = codepoints[c];
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (codepoint == '\n')
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                // NOTE: Line spacing is a line height factor, set with SetTextLineSpacingFactor()
+                textOffsetY += (int)(font.baseSize*textLineSpacingFactor*scaleFactor);
+                textOffsetX = 0.0f;
+                prevIndex = -1;
             }
+            else
+            {
+                if (prevIndex >= 0) textOffsetX += GetKerningAdvance(font.kerning, prevIndex, index)*scaleFactor;
+                prevIndex = index;
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
-            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
-        }
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                }
 
-        i += codepointByteCount;   // Move text bytes counter to next codepoint
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+            }
+        }
     }
 }
 
@@ -1104,23 +1458,7 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
 {
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
-    int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
-
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTextGlyph(font, GetGlyphIndex(font, codepoint), position, fontSize, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1128,6 +1466,7 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
 {
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int prevIndex = -1;             // Previous glyph index in line, for kerning
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
@@ -1137,16 +1476,19 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
 
         if (codepoints[i] == '\n')
         {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
+            // NOTE: Line spacing is a line height factor, set with SetTextLineSpacingFactor()
+            textOffsetY += (int)(font.baseSize*textLineSpacingFactor*scaleFactor);
             textOffsetX = 0.0f;
+            prevIndex = -1;
         }
         else
         {
+            if (prevIndex >= 0) textOffsetX += GetKerningAdvance(font.kerning, prevIndex, index)*scaleFactor;
+            prevIndex = index;
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1155,76 +1497,530 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
     }
 }
 
-// Measure string width for default font
-int MeasureText(const char *text, int fontSize)
+// Load text layout, glyphs resolved and positioned once to be drawn many times
+// NOTE: Layout matches DrawTextEx() glyphs placement and MeasureTextEx() size
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-    Vector2 textSize = { 0.0f, 0.0f };
+    TextLayout layout = { 0 };
 
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
-    {
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    if (size > 0)
+    {
+        // NOTE: Glyphs count is never bigger than text size in bytes
+        layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
+        layout.srcRecs = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
+        layout.dstRecs = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
     }
 
-    return (int)textSize.x;
-}
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
 
-// Measure string size for Font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
-{
-    Vector2 textSize = { 0 };
+    float textWidth = 0.0f;         // Current line width (unscaled), as MeasureTextEx()
+    float maxTextWidth = 0.0f;      // Longer line width (unscaled)
+    float textHeight = (float)font.baseSize;
+    int lineCodepoints = 0;         // Current line codepoints count, to add spacing
+    int maxLineCodepoints = 0;      // Longer line codepoints count
+    int prevIndex = -1;             // Previous glyph index in line, for kerning
 
-    if ((font.texture.id == 0) || (text == NULL)) return textSize;
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
 
-    int size = TextLength(text);    // Get size in bytes of text
-    int tempByteCounter = 0;        // Used to count longer text line num chars
-    int byteCounter = 0;
+    int codepoints[TEXT_DECODE_CHUNK_SIZE];             // Text codepoints, decoded by chunks (not cleared)
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoints chunk from byte string, text bytes counter moved to next codepoint
+        // NOTE: Codepoints are decoded as GetCodepointNext(), ASCII bytes are decoded in blocks
+        int count = GetCodepointsNext(text, size, &i, codepoints, TEXT_DECODE_CHUNK_SIZE);
 
-    float textHeight = (float)font.baseSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+        for (int c = 0; c < count; c++)
+        {
+            // Get glyph index in font
+            int codepoint = codepoints[c];
+            int index = GetGlyphIndex(font, codepoint);
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+            if (codepoint == '\n')
+            {
+                // NOTE: Line spacing is a line height factor, set with SetTextLineSpacingFactor()
+                textOffsetY += (int)(font.baseSize*textLineSpacingFactor*scaleFactor);
+                textOffsetX = 0.0f;
+
+                if (maxTextWidth < textWidth) maxTextWidth = textWidth;
+                textWidth = 0.0f;
+                textHeight += ((float)font.baseSize*textLineSpacingFactor);
+                lineCodepoints = 0;
+                prevIndex = -1;
+            }
+            else
+            {
+                if (prevIndex >= 0)
+                {
+                    float kerning = GetKerningAdvance(font.kerning, prevIndex, index);
+                    textOffsetX += kerning*scaleFactor;
+                    textWidth += kerning;
+                }
 
-    for (int i = 0; i < size; i++)
-    {
-        byteCounter++;
+                prevIndex = index;
 
-        int next = 0;
-        letter = GetCodepointNext(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    Rectangle rec = font.recs[index];
+
+                    layout.codepoints[layout.glyphCount] = codepoint;
+                    layout.srcRecs[layout.glyphCount] = (Rectangle){ rec.x - padding, rec.y - padding, rec.width + 2.0f*padding, rec.height + 2.0f*padding };
+                    layout.dstRecs[layout.glyphCount] = (Rectangle){ textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor,
+                                                                     textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor,
+                                                                     (rec.width + 2.0f*padding)*scaleFactor, (rec.height + 2.0f*padding)*scaleFactor };
+                    layout.glyphCount++;
+                }
 
-        // NOTE: normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all the bad bytes using the '?' symbol so to not skip any we set next = 1
-        if (letter == 0x3f) next = 1;
-        i += next - 1;
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
 
-        if (letter != '\n')
-        {
-            if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
-        }
-        else
-        {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
-            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
-        }
+                if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+                else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
 
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+                lineCodepoints++;
+                if (maxLineCodepoints < lineCodepoints) maxLineCodepoints = lineCodepoints;
+            }
+        }
     }
 
-    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+    if (maxTextWidth < textWidth) maxTextWidth = textWidth;
 
-    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing); // Adds chars spacing to measure
+    layout.size.x = maxTextWidth*scaleFactor + (float)((maxLineCodepoints - 1)*spacing);
+    layout.size.y = textHeight*scaleFactor;
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.srcRecs);
+    RL_FREE(layout.dstRecs);
+}
+
+// Draw text layout (same font used to load it), glyphs drawn in one batch
+void DrawTextLayout(Font font, TextLayout layout, Vector2 position, Color tint)
+{
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL)
+    {
+        // Dynamic fonts glyphs could be evicted and packed again in any page, source is resolved on drawing
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            int index = GetGlyphIndex(font, layout.codepoints[i]);
+            Texture2D texture = GetGlyphCacheTexture((GlyphCache *)font.glyphCache, index);
+
+            Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                                 font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+            Rectangle dstRec = layout.dstRecs[i];
+            dstRec.x += position.x;
+            dstRec.y += position.y;
+
+            DrawTexturePro(texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+        }
+
+        return;
+    }
+#endif
+
+    if ((font.texture.id > 0) && (layout.glyphCount > 0))
+    {
+        float width = (float)font.texture.width;
+        float height = (float)font.texture.height;
+
+        // NOTE: All glyphs share the font texture, quads are added to the batch directly
+        rlSetTexture(font.texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            for (int i = 0; i < layout.glyphCount; i++)
+            {
+                Rectangle src = layout.srcRecs[i];
+                float x = position.x + layout.dstRecs[i].x;
+                float y = position.y + layout.dstRecs[i].y;
+                float w = layout.dstRecs[i].width;
+                float h = layout.dstRecs[i].height;
+
+                rlTexCoord2f(src.x/width, src.y/height);
+                rlVertex2f(x, y);
+                rlTexCoord2f(src.x/width, (src.y + src.height)/height);
+                rlVertex2f(x, y + h);
+                rlTexCoord2f((src.x + src.width)/width, (src.y + src.height)/height);
+                rlVertex2f(x + w, y + h);
+                rlTexCoord2f((src.x + src.width)/width, src.y/height);
+                rlVertex2f(x + w, y);
+            }
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+// Set text layouts cache capacity, DrawTextEx()/MeasureTextEx() reuse cached layouts (0 to disable, default)
+// NOTE: Layouts are cached by text contents, font, size and spacing, least recently used layouts are evicted
+void SetTextLayoutCache(int capacity)
+{
+    ClearTextLayoutCache();
+
+    RL_FREE(textLayoutCache.entries);
+    RL_FREE(textLayoutCache.buckets);
+    textLayoutCache = (TextLayoutCache){ 0 };
+
+    if (capacity > 0)
+    {
+        textLayoutCache.entries = (TextLayoutCacheEntry *)RL_CALLOC(capacity, sizeof(TextLayoutCacheEntry));
+
+        textLayoutCache.bucketCount = 1;
+        while (textLayoutCache.bucketCount < capacity) textLayoutCache.bucketCount <<= 1;
+        textLayoutCache.buckets = (int *)RL_MALLOC(textLayoutCache.bucketCount*sizeof(int));
+        for (int i = 0; i < textLayoutCache.bucketCount; i++) textLayoutCache.buckets[i] = -1;
+
+        textLayoutCache.head = -1;
+        textLayoutCache.tail = -1;
+        textLayoutCache.stats.capacity = capacity;
+
+        TRACELOG(LOG_INFO, "TEXT: Layout cache enabled (%i layouts)", capacity);
+    }
+}
+
+// Get text layouts cache stats (hits, misses, evictions)
+TextLayoutCacheStats GetTextLayoutCacheStats(void)
+{
+    TextLayoutCacheStats stats = textLayoutCache.stats;
+    stats.layoutCount = textLayoutCache.count;
+
+    return stats;
+}
+
+// Set text line spacing factor, line height relative to font size (1.5 by default)
+// NOTE: Used by DrawTextEx(), MeasureTextEx(), text layouts and text boxes (on loading)
+void SetTextLineSpacingFactor(float factor)
+{
+    // Cached text layouts were laid out with previous line spacing
+    if (factor != textLineSpacingFactor) ClearTextLayoutCache();
+
+    textLineSpacingFactor = factor;
+}
+
+// Get text line spacing factor
+// NOTE: Required by ImageTextEx() [module: textures]
+extern float GetTextLineSpacingFactor(void)
+{
+    return textLineSpacingFactor;
+}
+
+// Load text box, text wrapped to width (0 for no wrapping), line breaks cached
+// NOTE: Lines are broken at spaces (or between CJK characters), words longer than width are broken at any character
+TextBox LoadTextBox(Font font, const char *text, float fontSize, float spacing, float width)
+{
+    TextBox box = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    box.font = font;
+    box.fontSize = fontSize;
+    box.spacing = spacing;
+    box.width = width;
+    box.lineSpacing = textLineSpacingFactor;
+    box.alignment = TEXT_ALIGN_LEFT;
+    box.lineData = RL_CALLOC(1, sizeof(TextBoxData));
+
+    SetTextBoxText(&box, text);
+
+    return box;
+}
+
+// Unload text box data
+void UnloadTextBox(TextBox box)
+{
+    if (box.lineData != NULL) RL_FREE(((TextBoxData *)box.lineData)->lines);
+    RL_FREE(box.lineData);
+    RL_FREE(box.text);
+}
+
+// Set text box text, all lines are wrapped
+void SetTextBoxText(TextBox *box, const char *text)
+{
+    if ((box == NULL) || (box->lineData == NULL)) return;
+
+    // Text replaced, appended text is wrapped from first line
+    box->textSize = 0;
+    box->lineCount = 0;
+
+    AppendTextBoxText(box, text);
+}
+
+// Append text to text box, only last paragraph lines are wrapped again
+// NOTE: Previous paragraphs lines are kept, useful for chat logs or typewriter effects
+void AppendTextBoxText(TextBox *box, const char *text)
+{
+    if ((box == NULL) || (box->lineData == NULL)) return;
+
+    TextBoxData *data = (TextBoxData *)box->lineData;
+    int size = TextLength(text);
+    int firstLine = data->paragraphLine;
+
+    // Sequence truncated at previous text end (decoded as '?') could be completed by appended text,
+    // lines are wrapped again from the line before the one containing it (its wrap could measure it)
+    // NOTE: Continuation bytes are not validated, sequence could include a paragraph break
+    for (int i = ((box->textSize > 3)? box->textSize - 3 : 0); (size > 0) && (i < box->textSize); i++)
+    {
+        unsigned char byte = (unsigned char)box->text[i];
+        int sequenceSize = ((byte & 0xf8) == 0xf0)? 4 : ((byte & 0xf0) == 0xe0)? 3 : ((byte & 0xe0) == 0xc0)? 2 : 1;
+
+        if ((i + sequenceSize) > box->textSize)
+        {
+            while ((firstLine > 0) && ((firstLine >= box->lineCount) || (data->lines[firstLine].start > i))) firstLine--;
+            if (firstLine > 0) firstLine--;
+            break;
+        }
+    }
+
+    // Text buffer grows by doubling capacity, appended text is copied once
+    if ((box->textSize + size + 1) > data->textCapacity)
+    {
+        int capacity = (data->textCapacity > 0)? data->textCapacity : 64;
+        while (capacity < (box->textSize + size + 1)) capacity *= 2;
+
+        box->text = (char *)RL_REALLOC(box->text, capacity);
+        data->textCapacity = capacity;
+    }
+
+    if (size > 0) memcpy(box->text + box->textSize, text, size);
+    box->textSize += size;
+    box->text[box->textSize] = '\0';
+
+    WrapTextBoxLines(box, firstLine);
+}
+
+// Set text box wrap width, all lines are wrapped
+void SetTextBoxWidth(TextBox *box, float width)
+{
+    if ((box == NULL) || (box->lineData == NULL)) return;
+
+    box->width = width;
+    WrapTextBoxLines(box, 0);
+}
+
+// Measure text box size (all lines)
+// NOTE: Width is the longer line width, height matches MeasureTextEx() for same line spacing
+Vector2 MeasureTextBox(TextBox box)
+{
+    Vector2 size = { 0 };
+
+    if ((box.lineData == NULL) || (box.lineCount == 0)) return size;
+
+    TextBoxLine *lines = ((TextBoxData *)box.lineData)->lines;
+
+    for (int i = 0; i < box.lineCount; i++) if (lines[i].width > size.x) size.x = lines[i].width;
+
+    size.y = box.fontSize + (box.lineCount - 1)*box.fontSize*box.lineSpacing;
+
+    return size;
+}
+
+// Draw text box lines (from firstLine, up to maxLines), aligned, with ellipsis if text continues
+// NOTE: Only drawn lines are processed, cached line breaks are not measured again
+void DrawTextBox(TextBox box, Vector2 position, Color tint)
+{
+    if ((box.lineData == NULL) || (box.lineCount == 0)) return;
+
+    TextBoxLine *lines = ((TextBoxData *)box.lineData)->lines;
+    Font font = box.font;
+    float scaleFactor = box.fontSize/font.baseSize;
+    float lineHeight = box.fontSize*box.lineSpacing;
+
+    int firstLine = (box.firstLine < 0)? 0 : box.firstLine;
+    int lastLine = ((box.maxLines > 0) && ((firstLine + box.maxLines) < box.lineCount))? (firstLine + box.maxLines) : box.lineCount;
+    bool ellipsis = (lastLine < box.lineCount);
+
+    // Lines are aligned to wrap width or to longer line (no wrapping)
+    float alignWidth = box.width;
+    if ((alignWidth <= 0.0f) && (box.alignment != TEXT_ALIGN_LEFT)) alignWidth = MeasureTextBox(box).x;
+
+    // Ellipsis glyph: '…' if available in font, three '.' otherwise
+    int ellipsisIndex = GetGlyphIndex(font, 0x2026);
+    int ellipsisCount = 1;
+    if (font.glyphs[ellipsisIndex].value != 0x2026)
+    {
+        ellipsisIndex = GetGlyphIndex(font, '.');
+        ellipsisCount = 3;
+    }
+
+    float ellipsisAdvance = ((font.glyphs[ellipsisIndex].advanceX == 0)? font.recs[ellipsisIndex].width : (float)font.glyphs[ellipsisIndex].advanceX)*scaleFactor;
+
+    for (int l = firstLine; l < lastLine; l++)
+    {
+        int end = lines[l].end;
+        float lineWidth = lines[l].width;
+        bool lineEllipsis = (ellipsis && (l == (lastLine - 1)));
+
+        if (lineEllipsis)
+        {
+            // Line truncated to fit ellipsis in wrap width
+            float ellipsisWidth = ellipsisCount*(ellipsisAdvance + box.spacing);
+            float offsetX = 0.0f;
+            int prevIndex = -1;
+
+            end = lines[l].start;
+            lineWidth = 0.0f;
+
+            for (int i = lines[l].start; i < lines[l].end;)
+            {
+                int codepoint = 0;
+                int next = i;
+                GetCodepointsNext(box.text, lines[l].end, &next, &codepoint, 1);
+                int codepointByteCount = next - i;
+                int index = GetGlyphIndex(font, codepoint);
+
+                if (prevIndex >= 0) offsetX += GetKerningAdvance(font.kerning, prevIndex, index)*scaleFactor;
+                prevIndex = index;
+
+                float advance = ((font.glyphs[index].advanceX == 0)? font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
+                if ((box.width > 0.0f) && ((offsetX + advance + ellipsisWidth) > box.width)) break;
+
+                offsetX += advance + box.spacing;
+                i += codepointByteCount;
+
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    end = i;
+                    lineWidth = offsetX - box.spacing;
+                }
+            }
+
+            lineWidth += ((end > lines[l].start)? box.spacing : 0.0f) + ellipsisWidth - box.spacing;
+        }
+
+        Vector2 linePosition = { position.x, position.y + (l - firstLine)*lineHeight };
+        if (box.alignment == TEXT_ALIGN_CENTER) linePosition.x += (alignWidth - lineWidth)/2.0f;
+        else if (box.alignment == TEXT_ALIGN_RIGHT) linePosition.x += (alignWidth - lineWidth);
+
+        // Draw line glyphs, same placement as DrawTextEx()
+        float textOffsetX = 0.0f;
+        int prevIndex = -1;
+
+        for (int i = lines[l].start; i < end;)
+        {
+            int codepoint = 0;
+            int next = i;
+            GetCodepointsNext(box.text, end, &next, &codepoint, 1);
+            int codepointByteCount = next - i;
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (prevIndex >= 0) textOffsetX += GetKerningAdvance(font.kerning, prevIndex, index)*scaleFactor;
+            prevIndex = index;
+
+            if ((codepoint != ' ') && (codepoint != '\t')) DrawTextGlyph(font, index, (Vector2){ linePosition.x + textOffsetX, linePosition.y }, box.fontSize, tint);
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + box.spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + box.spacing);
+
+            i += codepointByteCount;
+        }
+
+        if (lineEllipsis)
+        {
+            for (int i = 0; i < ellipsisCount; i++)
+            {
+                DrawTextGlyph(font, ellipsisIndex, (Vector2){ linePosition.x + textOffsetX, linePosition.y }, box.fontSize, tint);
+                textOffsetX += ellipsisAdvance + box.spacing;
+            }
+        }
+    }
+}
+
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
+{
+    Vector2 textSize = { 0.0f, 0.0f };
+
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    }
+
+    return (int)textSize.x;
+}
+
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    Vector2 textSize = { 0 };
+
+    if ((font.texture.id == 0) || (text == NULL)) return textSize;
+
+    // Get cached text layout size, if text layouts cache is enabled
+    if (textLayoutCache.stats.capacity > 0) return GetTextLayoutCached(font, text, fontSize, spacing)->size;
+
+    int size = TextLength(text);    // Get size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    int letter = 0;                 // Current character
+    int index = 0;                  // Index position in sprite font
+    int prevIndex = -1;             // Previous glyph index in line, for kerning
+
+    int codepoints[TEXT_DECODE_CHUNK_SIZE];             // Text codepoints, decoded by chunks (not cleared)
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoints chunk, ASCII bytes are decoded in blocks
+        int count = GetCodepointsNext(text, size, &i, codepoints, TEXT_DECODE_CHUNK_SIZE);
+
+        for (int c = 0; c < count; c++)
+        {
+            byteCounter++;
+
+            letter = codepoints[c];
+            index = GetGlyphIndex(font, letter);
+
+            if (letter != '\n')
+            {
+                if (prevIndex >= 0) textWidth += GetKerningAdvance(font.kerning, prevIndex, index);
+                prevIndex = index;
+
+                if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+                else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+            }
+            else
+            {
+                if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                byteCounter = 0;
+                textWidth = 0;
+                prevIndex = -1;
+                textHeight += ((float)font.baseSize*textLineSpacingFactor);
+            }
+
+            if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+        }
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing); // Adds chars spacing to measure
     textSize.y = textHeight*scaleFactor;
 
     return textSize;
@@ -1238,17 +2034,34 @@ int GetGlyphIndex(Font font, int codepoint)
     #define GLYPH_NOTFOUND_CHAR_FALLBACK     63      // Character used if requested codepoint is not found: '?'
 #endif
 
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    // Dynamic fonts glyphs are rasterized into cache on first use
+    if (font.glyphCache != NULL) return GetGlyphCacheIndex((GlyphCache *)font.glyphCache, codepoint);
+#endif
+
 // Support charsets with any characters order
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int index = GLYPH_NOTFOUND_CHAR_FALLBACK;
 
-    for (int i = 0; i < font.glyphCount; i++)
+    if (font.glyphLookup != NULL)
     {
-        if (font.glyphs[i].value == codepoint)
+        // Lookup codepoint page, pages with no glyphs point to an empty page (no glyph found)
+        if ((codepoint >= 0) && ((codepoint >> GLYPH_LOOKUP_PAGE_BITS) < font.glyphLookup[0]))
         {
-            index = i;
-            break;
+            int glyph = font.glyphLookup[font.glyphLookup[1 + (codepoint >> GLYPH_LOOKUP_PAGE_BITS)] + (codepoint & (GLYPH_LOOKUP_PAGE_SIZE - 1))];
+            if (glyph >= 0) index = glyph;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
         }
     }
 
@@ -1280,24 +2093,40 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
+// Get kerning advance between two codepoints (pixels at font base size), 0 if no kerning
+// NOTE: Advance is added to first glyph advanceX, scaled as advanceX for drawing
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    if (font.kerning == NULL) return 0.0f;
+
+    return GetKerningAdvance(font.kerning, GetGlyphIndex(font, codepoint), GetGlyphIndex(font, nextCodepoint));
+}
+
+// Set text kerning (font kerning pairs applied on text drawing and measuring), enabled by default
+void SetTextKerning(bool enabled)
+{
+    // Cached text layouts were laid out with previous kerning state
+    if (enabled != textKerning) ClearTextLayoutCache();
+
+    textKerning = enabled;
+}
+
 //----------------------------------------------------------------------------------
 // Text strings management functions
 //----------------------------------------------------------------------------------
 // Get text length in bytes, check for \0 character
+// REQUIRES: strlen()
 unsigned int TextLength(const char *text)
 {
-    unsigned int length = 0; //strlen(text)
+    unsigned int length = 0;
 
-    if (text != NULL)
-    {
-        while (*text++) length++;
-    }
+    if (text != NULL) length = (unsigned int)strlen(text);
 
     return length;
 }
 
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times (in same thread)
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1305,11 +2134,11 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    // NOTE: Buffers are per-thread, vsnprintf() always writes '\0', buffer is not cleared
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
@@ -1322,6 +2151,27 @@ const char *TextFormat(const char *text, ...)
     return currentBuffer;
 }
 
+// Formatting of text with variables to 'embed' into provided buffer, returns text length
+// NOTE: Text is truncated to fit buffer size ('\0' included), no static buffers used
+int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    va_list args;
+    va_start(args, text);
+    int length = vsnprintf(buffer, bufferSize, text, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        buffer[0] = '\0';      // Encoding error
+        length = 0;
+    }
+    else if (length >= bufferSize) length = bufferSize - 1;     // Text truncated
+
+    return length;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int TextToInteger(const char *text)
@@ -1378,30 +2228,34 @@ bool TextIsEqual(const char *text1, const char *text2)
 }
 
 // Get a piece of a text string
+// WARNING: String returned will expire after this function is called again (in same thread)
 const char *TextSubtext(const char *text, int position, int length)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    int textLength = TextLength(text);
+    TextSubtextBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text, position, length);
 
-    if (position >= textLength)
-    {
-        position = textLength - 1;
-        length = 0;
-    }
+    return buffer;
+}
 
-    if (length >= textLength) length = textLength;
+// Get a piece of a text string into provided buffer, returns piece length
+// NOTE: Piece is clamped to text end and truncated to fit buffer size ('\0' included)
+int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
 
-    for (int c = 0 ; c < length ; c++)
-    {
-        *(buffer + c) = *(text + position);
-        text++;
-    }
+    int textLength = TextLength(text);
 
-    *(buffer + length) = '\0';
+    if (position < 0) position = 0;
+    if (position > textLength) position = textLength;
+    if (length > (textLength - position)) length = textLength - position;
+    if (length > (bufferSize - 1)) length = bufferSize - 1;
+    if (length < 0) length = 0;
 
-    return buffer;
+    if (length > 0) memcpy(buffer, text + position, length);
+    buffer[length] = '\0';
+
+    return length;
 }
 
 // Replace text string
@@ -1473,11 +2327,23 @@ char *TextInsert(const char *text, const char *insert, int position)
 }
 
 // Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
+// WARNING: String returned will expire after this function is called again (in same thread)
 const char *TextJoin(const char **textList, int count, const char *delimiter)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextJoinBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, textList, count, delimiter);
+
+    return buffer;
+}
+
+// Join text strings with delimiter into provided buffer, returns joined text length
+// REQUIRES: memcpy()
+// NOTE: Strings that do not fit buffer size ('\0' included) are skipped
+int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
     char *textPtr = buffer;
 
     int totalLength = 0;
@@ -1486,67 +2352,104 @@ const char *TextJoin(const char **textList, int count, const char *delimiter)
     for (int i = 0; i < count; i++)
     {
         int textLength = TextLength(textList[i]);
+        int delimiterLength = ((delimiterLen > 0) && (i < (count - 1)))? delimiterLen : 0;
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
+        // Make sure joined text could fit inside buffer
+        if ((totalLength + textLength + delimiterLength) < bufferSize)
         {
             memcpy(textPtr, textList[i], textLength);
             totalLength += textLength;
             textPtr += textLength;
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
+            if (delimiterLength > 0)
             {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
+                memcpy(textPtr, delimiter, delimiterLength);
+                totalLength += delimiterLength;
+                textPtr += delimiterLength;
             }
         }
     }
 
-    return buffer;
+    *textPtr = '\0';
+
+    return totalLength;
 }
 
 // Split string into multiple strings
-// REQUIRES: memset()
+// WARNING: Strings returned will expire after this function is called again (in same thread)
 const char **TextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
     // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
+    // all used memory is static (per-thread)... it has some limitations:
     //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
     //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
+    // Use TextSplitSpans() to split text with no limitations
 
-    static const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
     result[0] = buffer;
+    buffer[0] = '\0';
     int counter = 0;
 
     if (text != NULL)
     {
         counter = 1;
+        int i = 0;
 
         // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        for (; i < (MAX_TEXT_BUFFER_LENGTH - 1); i++)
         {
             buffer[i] = text[i];
             if (buffer[i] == '\0') break;
             else if (buffer[i] == delimiter)
             {
                 buffer[i] = '\0';   // Set an end of string at this point
-                result[counter] = buffer + i + 1;
-                counter++;
 
                 if (counter == MAX_TEXTSPLIT_COUNT) break;
-            }
+
+                result[counter] = buffer + i + 1;
+                counter++;
+            }
         }
+
+        buffer[i] = '\0';      // Last substring end, buffer is not cleared
     }
 
     *count = counter;
     return result;
 }
 
+// Split string into substrings spans (position and length in text), returns spans count
+// NOTE: Text is not copied, spans are written to provided array (up to maxCount, last span ends at text end)
+int TextSplitSpans(const char *text, char delimiter, TextSpan *spans, int maxCount)
+{
+    if ((text == NULL) || (spans == NULL) || (maxCount <= 0)) return 0;
+
+    int counter = 0;
+    int start = 0;
+    int i = 0;
+
+    for (; text[i] != '\0'; i++)
+    {
+        if ((text[i] == delimiter) && (counter < (maxCount - 1)))
+        {
+            spans[counter].position = start;
+            spans[counter].length = i - start;
+            counter++;
+
+            start = i + 1;
+        }
+    }
+
+    spans[counter].position = start;
+    spans[counter].length = i - start;
+    counter++;
+
+    return counter;
+}
+
 // Append text at specific position and move cursor!
 // REQUIRES: strcpy()
 void TextAppend(char *text, const char *append, int *position)
@@ -1569,81 +2472,114 @@ int TextFindIndex(const char *text, const char *find)
 }
 
 // Get upper case version of provided string
-// REQUIRES: toupper()
+// WARNING: String returned will expire after this function is called again (in same thread)
 const char *TextToUpper(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToUpperBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get upper case version of provided string into provided buffer, returns text length
+// REQUIRES: toupper()
+int TextToUpperBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int length = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        for (; (length < (bufferSize - 1)) && (text[length] != '\0'); length++)
         {
-            if (text[i] != '\0')
-            {
-                buffer[i] = (char)toupper(text[i]);
-                //if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+            buffer[length] = (char)toupper(text[length]);
+            //if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
 
-                // TODO: Support UTF-8 diacritics to upper-case
-                //if ((text[i] >= 'à') && (text[i] <= 'ý')) buffer[i] = text[i] - 32;
-            }
-            else { buffer[i] = '\0'; break; }
+            // TODO: Support UTF-8 diacritics to upper-case
+            //if ((text[i] >= 'à') && (text[i] <= 'ý')) buffer[i] = text[i] - 32;
         }
     }
 
-    return buffer;
+    buffer[length] = '\0';
+
+    return length;
 }
 
 // Get lower case version of provided string
-// REQUIRES: tolower()
+// WARNING: String returned will expire after this function is called again (in same thread)
 const char *TextToLower(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToLowerBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get lower case version of provided string into provided buffer, returns text length
+// REQUIRES: tolower()
+int TextToLowerBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int length = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        for (; (length < (bufferSize - 1)) && (text[length] != '\0'); length++)
         {
-            if (text[i] != '\0')
-            {
-                buffer[i] = (char)tolower(text[i]);
-                //if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
-            }
-            else { buffer[i] = '\0'; break; }
+            buffer[length] = (char)tolower(text[length]);
+            //if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
         }
     }
 
-    return buffer;
+    buffer[length] = '\0';
+
+    return length;
 }
 
 // Get Pascal case notation version of provided string
-// REQUIRES: toupper()
+// WARNING: String returned will expire after this function is called again (in same thread)
 const char *TextToPascal(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    if (text != NULL)
+    TextToPascalBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get Pascal case notation version of provided string into provided buffer, returns text length
+// REQUIRES: toupper()
+int TextToPascalBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int length = 0;
+
+    if ((text != NULL) && (text[0] != '\0') && (bufferSize > 1))
     {
         buffer[0] = (char)toupper(text[0]);
+        length = 1;
 
-        for (int i = 1, j = 1; i < MAX_TEXT_BUFFER_LENGTH; i++, j++)
+        for (int j = 1; (length < (bufferSize - 1)) && (text[j] != '\0'); j++, length++)
         {
-            if (text[j] != '\0')
+            if (text[j] != '_') buffer[length] = text[j];
+            else
             {
-                if (text[j] != '_') buffer[i] = text[j];
-                else
-                {
-                    j++;
-                    buffer[i] = (char)toupper(text[j]);
-                }
+                j++;
+                if (text[j] == '\0') break;    // Text ending with '_'
+
+                buffer[length] = (char)toupper(text[j]);
             }
-            else { buffer[i] = '\0'; break; }
         }
     }
 
-    return buffer;
+    buffer[length] = '\0';
+
+    return length;
 }
 
 // Encode text codepoint into UTF-8 text
@@ -1683,17 +2619,14 @@ int *LoadCodepoints(const char *text, int *count)
 {
     int textLength = TextLength(text);
 
-    int codepointSize = 0;
     int codepointCount = 0;
 
     // Allocate a big enough buffer to store as many codepoints as text bytes
     int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
 
-    for (int i = 0; i < textLength; codepointCount++)
-    {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
-    }
+    // Decode all text codepoints at once, ASCII bytes are decoded in blocks
+    int position = 0;
+    codepointCount = GetCodepointsNext(text, textLength, &position, codepoints, textLength);
 
     // Re-allocate buffer to the actual number of codepoints loaded
     int *temp = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
@@ -1715,27 +2648,35 @@ void UnloadCodepoints(int *codepoints)
 int GetCodepointCount(const char *text)
 {
     unsigned int length = 0;
-    char *ptr = (char *)&text[0];
+    int size = TextLength(text);
+    int codepoints[TEXT_DECODE_CHUNK_SIZE];     // Decoded codepoints, only counted (not cleared)
 
-    while (*ptr != '\0')
+    for (int i = 0; i < size;)
     {
-        int next = 0;
-        int letter = GetCodepointNext(ptr, &next);
-
-        if (letter == 0x3f) ptr += 1;
-        else ptr += next;
+        if ((unsigned char)text[i] < 0x80)
+        {
+            // ASCII bytes counted in blocks, one codepoint each
+            int asciiLength = GetTextAsciiLength(text + i, size - i);
 
-        length++;
+            i += asciiLength;
+            length += asciiLength;
+        }
+        else
+        {
+            // Multi-byte sequences, decoded by chunks (as LoadCodepoints())
+            // NOTE: A sequence truncated at text end is counted as '?' bytes
+            length += GetCodepointsNext(text, size, &i, codepoints, TEXT_DECODE_CHUNK_SIZE);
+        }
     }
 
     return length;
 }
 
 // Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
+// NOTE: It uses a static array to store UTF-8 bytes (per-thread)
 const char *CodepointToUTF8(int codepoint, int *utf8Size)
 {
-    static char utf8[6] = { 0 };
+    static RL_THREAD_LOCAL char utf8[6] = { 0 };
     int size = 0;   // Byte size of codepoint
 
     if (codepoint <= 0x7f)
@@ -2081,6 +3022,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     UnloadFileText(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -2093,4 +3036,1539 @@ static Font LoadBMFont(const char *fileName)
 }
 #endif
 
+// Load codepoint to glyph index lookup (pages table)
+// NOTE: Lookup data: [0] pages count, [1..count] pages offsets, then pages of glyph indices (-1 if no glyph),
+// pages with no glyphs share the first (empty) page, first glyph is used for duplicated codepoints
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    int maxCodepoint = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        // NOTE: Not valid codepoints are not supported by lookup, linear search is used
+        if ((glyphs[i].value < 0) || (glyphs[i].value > 0x10ffff)) return NULL;
+        if (glyphs[i].value > maxCodepoint) maxCodepoint = glyphs[i].value;
+    }
+
+    int pageCount = (maxCodepoint >> GLYPH_LOOKUP_PAGE_BITS) + 1;
+    int *pageOffsets = (int *)RL_CALLOC(pageCount, sizeof(int));
+    int size = 1 + pageCount + GLYPH_LOOKUP_PAGE_SIZE;      // Header and empty page
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int page = glyphs[i].value >> GLYPH_LOOKUP_PAGE_BITS;
+
+        if (pageOffsets[page] == 0)
+        {
+            pageOffsets[page] = size;
+            size += GLYPH_LOOKUP_PAGE_SIZE;
+        }
+    }
+
+    int *lookup = (int *)RL_MALLOC(size*sizeof(int));
+
+    lookup[0] = pageCount;
+    for (int i = 0; i < pageCount; i++) lookup[1 + i] = (pageOffsets[i] == 0)? (1 + pageCount) : pageOffsets[i];
+    for (int i = 1 + pageCount; i < size; i++) lookup[i] = -1;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int *glyph = &lookup[pageOffsets[glyphs[i].value >> GLYPH_LOOKUP_PAGE_BITS] + (glyphs[i].value & (GLYPH_LOOKUP_PAGE_SIZE - 1))];
+        if (*glyph == -1) *glyph = i;
+    }
+
+    RL_FREE(pageOffsets);
+
+    return lookup;
+}
+
+// Get kerning advance for a glyphs indices pair (pixels at font base size), 0 if no pair or kerning disabled
+static float GetKerningAdvance(const void *kerning, int index, int nextIndex)
+{
+    const KerningTable *table = (const KerningTable *)kerning;
+
+    if (!textKerning || (table == NULL) || (index >= 0xffff) || (nextIndex >= 0xffff)) return 0.0f;
+
+    unsigned int key = ((unsigned int)index << 16) | (unsigned int)nextIndex;
+    unsigned int hash = key*2654435761u;
+    unsigned int mask = (unsigned int)table->tableSize - 1;
+
+    // Linear probing until pair or an empty entry is found, table is never full
+    for (unsigned int slot = (hash ^ (hash >> 16)) & mask; table->pairs[slot].key != KERNING_PAIR_EMPTY; slot = (slot + 1) & mask)
+    {
+        if (table->pairs[slot].key == key) return table->pairs[slot].advance;
+    }
+
+    return 0.0f;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font kerning pairs table from TTF/OTF data, NULL if font has no kerning pairs
+// NOTE: Pairs are extracted once on loading, from 'kern' table or querying all glyphs pairs (GPOS),
+// glyphs indices in font are used as keys so no font file lookup is required on drawing
+static void *LoadFontKerning(const unsigned char *fileData, const GlyphInfo *glyphs, int glyphCount, int fontSize)
+{
+    KerningTable *table = NULL;
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if ((fileData == NULL) || (glyphs == NULL) || !stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0)) return NULL;
+
+    // Fonts with no kerning data
+    if ((fontInfo.kern == 0) && (fontInfo.gpos == 0)) return NULL;
+
+    // Glyphs indices over 16 bit are not supported by kerning table keys
+    if (glyphCount > 0xffff) glyphCount = 0xffff;
+
+    int *glyphIds = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int i = 0; i < glyphCount; i++) glyphIds[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+    FontKerningJobData job = { &fontInfo, glyphIds, glyphCount, stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize), NULL, 0, 0 };
+    int tableLength = stbtt_GetKerningTableLength(&fontInfo);
+
+    if ((fontInfo.gpos == 0) && (tableLength > 0))
+    {
+        // Kerning pairs listed by 'kern' table (format 0), mapped from TTF glyph ids to font glyphs indices
+        stbtt_kerningentry *entries = (stbtt_kerningentry *)RL_MALLOC(tableLength*sizeof(stbtt_kerningentry));
+        tableLength = stbtt_GetKerningTable(&fontInfo, entries, tableLength);
+
+        int *glyphIndices = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) glyphIndices[i] = -1;
+        for (int i = glyphCount - 1; i >= 0; i--) if ((glyphIds[i] > 0) && (glyphIds[i] < fontInfo.numGlyphs)) glyphIndices[glyphIds[i]] = i;
+
+        job.pairs = (KerningPair *)RL_MALLOC(tableLength*sizeof(KerningPair));
+
+        for (int i = 0; i < tableLength; i++)
+        {
+            if ((entries[i].glyph1 >= fontInfo.numGlyphs) || (entries[i].glyph2 >= fontInfo.numGlyphs) || (entries[i].advance == 0)) continue;
+
+            int index = glyphIndices[entries[i].glyph1];
+            int nextIndex = glyphIndices[entries[i].glyph2];
+
+            if ((index >= 0) && (nextIndex >= 0))
+            {
+                job.pairs[job.pairCount] = (KerningPair){ ((unsigned int)index << 16) | (unsigned int)nextIndex, (float)entries[i].advance*job.scaleFactor };
+                job.pairCount++;
+            }
+        }
+
+        RL_FREE(glyphIndices);
+        RL_FREE(entries);
+    }
+    else
+    {
+        // Kerning pairs not listed (GPOS pair adjustments), all glyphs pairs are queried on worker threads
+        // NOTE: Pairs count is quadratic, only first glyphs are queried for big charsets (usually CJK fonts, no kerning)
+        if (job.glyphCount > FONT_KERNING_MAX_PAIR_GLYPHS)
+        {
+            TRACELOG(LOG_INFO, "FONT: Kerning pairs only loaded for first %i glyphs", FONT_KERNING_MAX_PAIR_GLYPHS);
+            job.glyphCount = FONT_KERNING_MAX_PAIR_GLYPHS;
+        }
+
+        RunWorkerJobs(LoadFontKerningJob, &job, job.glyphCount, 16);
+    }
+
+    if (job.pairCount > 0)
+    {
+        int tableSize = 1;
+        while (tableSize < job.pairCount*2) tableSize <<= 1;    // Load factor 0.5 at most
+
+        table = (KerningTable *)RL_MALLOC(sizeof(KerningTable) + tableSize*sizeof(KerningPair));
+        table->pairCount = 0;
+        table->tableSize = tableSize;
+        table->pairs = (KerningPair *)(table + 1);
+
+        for (int i = 0; i < tableSize; i++) table->pairs[i].key = KERNING_PAIR_EMPTY;
+
+        for (int i = 0; i < job.pairCount; i++)
+        {
+            unsigned int hash = job.pairs[i].key*2654435761u;
+            unsigned int slot = (hash ^ (hash >> 16)) & (tableSize - 1);
+
+            while ((table->pairs[slot].key != KERNING_PAIR_EMPTY) && (table->pairs[slot].key != job.pairs[i].key)) slot = (slot + 1) & (tableSize - 1);
+
+            // NOTE: First pair is kept for duplicated pairs
+            if (table->pairs[slot].key == KERNING_PAIR_EMPTY)
+            {
+                table->pairs[slot] = job.pairs[i];
+                table->pairCount++;
+            }
+        }
+
+        TRACELOG(LOG_INFO, "FONT: Kerning pairs loaded successfully (%i pairs)", table->pairCount);
+    }
+
+    RL_FREE(job.pairs);
+    RL_FREE(glyphIds);
+
+    return table;
+}
+
+// Load font kerning pairs for glyphs range [start..end), pairs with any font glyph
+// NOTE: Called from worker threads, pairs found are added to shared output with worker data locked
+static void LoadFontKerningJob(void *userData, int start, int end)
+{
+    FontKerningJobData *job = (FontKerningJobData *)userData;
+
+    int pairCount = 0;
+    int pairCapacity = 64;
+    KerningPair *pairs = (KerningPair *)RL_MALLOC(pairCapacity*sizeof(KerningPair));
+
+    for (int i = start; i < end; i++)
+    {
+        if (job->glyphIds[i] == 0) continue;    // Glyph not found in font
+
+        for (int j = 0; j < job->glyphCount; j++)
+        {
+            if (job->glyphIds[j] == 0) continue;
+
+            int advance = stbtt_GetGlyphKernAdvance(job->fontInfo, job->glyphIds[i], job->glyphIds[j]);
+
+            if (advance != 0)
+            {
+                if (pairCount == pairCapacity)
+                {
+                    pairCapacity *= 2;
+                    pairs = (KerningPair *)RL_REALLOC(pairs, pairCapacity*sizeof(KerningPair));
+                }
+
+                pairs[pairCount] = (KerningPair){ ((unsigned int)i << 16) | (unsigned int)j, (float)advance*job->scaleFactor };
+                pairCount++;
+            }
+        }
+    }
+
+    if (pairCount > 0)
+    {
+        LockWorkerData();
+
+        if ((job->pairCount + pairCount) > job->pairCapacity)
+        {
+            job->pairCapacity = job->pairCount + pairCount;
+            job->pairs = (KerningPair *)RL_REALLOC(job->pairs, job->pairCapacity*sizeof(KerningPair));
+        }
+
+        memcpy(job->pairs + job->pairCount, pairs, pairCount*sizeof(KerningPair));
+        job->pairCount += pairCount;
+
+        UnlockWorkerData();
+    }
+
+    RL_FREE(pairs);
+}
+#endif
+
+// Draw one glyph from its index in font
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // Character destination rectangle on screen
+    // NOTE: We consider glyphPadding on drawing
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    Texture2D texture = font.texture;
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL) texture = GetGlyphCacheTexture((GlyphCache *)font.glyphCache, index);
+#endif
+
+    // Draw the character texture on the screen
+    DrawTexturePro(texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font glyphs range [start..end) data, rasterized with stb_truetype
+// NOTE: Called from worker threads, font info is only read and every glyph is written to its index
+static void LoadFontGlyphsJob(void *userData, int start, int end)
+{
+    FontGlyphsJobData *job = (FontGlyphsJobData *)userData;
+
+    const stbtt_fontinfo *fontInfo = job->fontInfo;
+    GlyphInfo *chars = job->chars;
+    const int *fontChars = job->fontChars;
+    int fontSize = job->fontSize;
+    float scaleFactor = job->scaleFactor;
+    int ascent = job->ascent;
+    int type = job->type;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = fontChars[i];  // Character value to get info for
+        chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if ((type != FONT_SDF) && (type != FONT_MSDF)) chars[i].image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if (ch == 32) chars[i].image.data = NULL;
+        else if (type == FONT_SDF) chars[i].image.data = stbtt_GetCodepointSDF(fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else chars[i].image.data = LoadGlyphMSDF(fontInfo, scaleFactor, ch, FONT_MSDF_CHAR_PADDING, FONT_MSDF_PIXEL_RANGE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+
+        stbtt_GetCodepointHMetrics(fontInfo, ch, &chars[i].advanceX, NULL);
+        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+        // Load characters images
+        chars[i].image.width = chw;
+        chars[i].image.height = chh;
+        chars[i].image.mipmaps = 1;
+        chars[i].image.format = (type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        chars[i].offsetY += (int)((float)ascent*scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = RL_CALLOC(chars[i].advanceX*fontSize, (type == FONT_MSDF)? 3 : 2),
+                .width = chars[i].advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = chars[i].image.format
+            };
+
+            chars[i].image = imSpace;
+        }
+
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                else ((unsigned char *)chars[i].image.data)[p] = 255;
+            }
+        }
+
+        // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+        */
+    }
+}
+
+// Load glyph MSDF image data (RGB) from glyph outline
+// NOTE: Multi-channel signed distance field generation, based on msdfgen (Viktor Chlumsky) simple edge coloring:
+// outline edges are split by corners and colored, every channel stores the distance to its colored edges,
+// so corners are kept sharp when rendering the median of the three channels at any scale
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, float range, int *width, int *height, int *offsetX, int *offsetY)
+{
+    unsigned char *data = NULL;
+    *width = 0;
+    *height = 0;
+
+    int glyph = stbtt_FindGlyphIndex(fontInfo, codepoint);
+    int ix0 = 0, iy0 = 0, ix1 = 0, iy1 = 0;
+    stbtt_GetGlyphBitmapBoxSubpixel(fontInfo, glyph, scale, scale, 0.0f, 0.0f, &ix0, &iy0, &ix1, &iy1);
+
+    // Glyph with no pixels (i.e. space)
+    if ((ix0 == ix1) || (iy0 == iy1)) return NULL;
+
+    ix0 -= padding;
+    iy0 -= padding;
+    ix1 += padding;
+    iy1 += padding;
+
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetGlyphShape(fontInfo, glyph, &vertices);
+
+    // Load outline edges, transformed to image pixel space (Y down)
+    // NOTE: Every vertex adds one edge at most, contours could be closed (one edge) and split (four more edges)
+    MsdfEdge *edges = (MsdfEdge *)RL_MALLOC((vertexCount*6 + 8)*sizeof(MsdfEdge));
+    int edgeCount = 0;
+    int contourStart = 0;
+    Vector2 first = { 0 };
+    Vector2 last = { 0 };
+    float area = 0.0f;
+
+    for (int i = 0; i <= vertexCount; i++)
+    {
+        // Close current contour on next contour start (or outline end)
+        if ((i == vertexCount) || (vertices[i].type == STBTT_vmove))
+        {
+            if ((edgeCount > contourStart) && ((last.x != first.x) || (last.y != first.y)))
+            {
+                edges[edgeCount] = (MsdfEdge){ { last, first }, 2, 7 };
+                edgeCount++;
+            }
+
+            if (edgeCount > contourStart) SetMsdfContourColors(edges, &edgeCount, contourStart);
+            contourStart = edgeCount;
+
+            if (i == vertexCount) break;
+        }
+
+        Vector2 point = { vertices[i].x*scale - ix0, -vertices[i].y*scale - iy0 };
+        MsdfEdge edge = { { last, point }, 2, 7 };
+
+        switch (vertices[i].type)
+        {
+            case STBTT_vmove: first = point; edge.pointCount = 0; break;
+            case STBTT_vcurve:
+            {
+                edge.p[1] = (Vector2){ vertices[i].cx*scale - ix0, -vertices[i].cy*scale - iy0 };
+                edge.p[2] = point;
+                edge.pointCount = 3;
+            } break;
+            case STBTT_vcubic:
+            {
+                edge.p[1] = (Vector2){ vertices[i].cx*scale - ix0, -vertices[i].cy*scale - iy0 };
+                edge.p[2] = (Vector2){ vertices[i].cx1*scale - ix0, -vertices[i].cy1*scale - iy0 };
+                edge.p[3] = point;
+                edge.pointCount = 4;
+            } break;
+            default: break;
+        }
+
+        // Skip degenerate edges (all control points equal)
+        bool degenerate = true;
+        for (int k = 1; k < edge.pointCount; k++) if ((edge.p[k].x != edge.p[0].x) || (edge.p[k].y != edge.p[0].y)) degenerate = false;
+
+        if (!degenerate)
+        {
+            edges[edgeCount] = edge;
+            edgeCount++;
+        }
+
+        last = point;
+    }
+
+    stbtt_FreeShape(fontInfo, vertices);
+
+    // Outline orientation from control polygons area, TrueType and CFF outlines use opposite winding
+    for (int i = 0; i < edgeCount; i++)
+    {
+        for (int k = 0; k < edges[i].pointCount - 1; k++) area += edges[i].p[k].x*edges[i].p[k + 1].y - edges[i].p[k + 1].x*edges[i].p[k].y;
+    }
+
+    float polarity = (area < 0.0f)? 1.0f : -1.0f;
+
+    *width = ix1 - ix0;
+    *height = iy1 - iy0;
+    *offsetX = ix0;
+    *offsetY = iy0;
+
+    // Compute channels distances at every pixel center, normalized to [0..1] range (0.5 on edge, inside is greater)
+    float *field = (float *)RL_MALLOC((*width)*(*height)*3*sizeof(float));
+
+    for (int y = 0; y < *height; y++)
+    {
+        for (int x = 0; x < *width; x++)
+        {
+            Vector2 origin = { x + 0.5f, y + 0.5f };
+            MsdfDistance minDistance[3] = { { 1e30f, 1.0f }, { 1e30f, 1.0f }, { 1e30f, 1.0f } };
+            int nearEdge[3] = { -1, -1, -1 };
+            float nearParam[3] = { 0 };
+
+            for (int e = 0; e < edgeCount; e++)
+            {
+                float param = 0.0f;
+                MsdfDistance distance = GetMsdfEdgeDistance(&edges[e], origin, &param);
+                float absDistance = fabsf(distance.distance);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    float absMinDistance = fabsf(minDistance[c].distance);
+
+                    if ((edges[e].color & (1 << c)) && ((absDistance < absMinDistance) || ((absDistance == absMinDistance) && (distance.dot < minDistance[c].dot))))
+                    {
+                        minDistance[c] = distance;
+                        nearEdge[c] = e;
+                        nearParam[c] = param;
+                    }
+                }
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                float distance = -range;
+
+                if (nearEdge[c] >= 0)
+                {
+                    // Distance to edge ends is extended along edge direction (pseudo-distance), keeps channels consistent at corners
+                    const MsdfEdge *edge = &edges[nearEdge[c]];
+                    distance = minDistance[c].distance;
+
+                    if ((nearParam[c] < 0.0f) || (nearParam[c] > 1.0f))
+                    {
+                        float t = (nearParam[c] < 0.0f)? 0.0f : 1.0f;
+                        Vector2 dir = GetMsdfEdgeDirection(edge, t);
+                        Vector2 end = GetMsdfEdgePoint(edge, t);
+                        Vector2 eq = { origin.x - end.x, origin.y - end.y };
+                        float length = sqrtf(dir.x*dir.x + dir.y*dir.y);
+                        float ts = (eq.x*dir.x + eq.y*dir.y)/length;
+
+                        if (((t == 0.0f) && (ts < 0.0f)) || ((t == 1.0f) && (ts > 0.0f)))
+                        {
+                            float pseudoDistance = (eq.x*dir.y - eq.y*dir.x)/length;
+                            if (fabsf(pseudoDistance) <= fabsf(distance)) distance = pseudoDistance;
+                        }
+                    }
+
+                    distance *= polarity;
+                }
+
+                field[(y*(*width) + x)*3 + c] = distance/range + 0.5f;
+            }
+        }
+    }
+
+    RL_FREE(edges);
+
+    // Sign correction: overlapping contours produce wrong inside/outside distances, checked against glyph coverage
+    // NOTE: Coverage is rasterized with non-zero winding rule, only texels clearly inside or outside are flipped
+    unsigned char *coverage = (unsigned char *)RL_CALLOC((*width)*(*height), 1);
+    stbtt_MakeGlyphBitmapSubpixel(fontInfo, coverage + padding*(*width) + padding, *width - 2*padding, *height - 2*padding, *width, scale, scale, 0.0f, 0.0f, glyph);
+
+    for (int i = 0; i < (*width)*(*height); i++)
+    {
+        float *texel = &field[i*3];
+        float median = fmaxf(fminf(texel[0], texel[1]), fminf(fmaxf(texel[0], texel[1]), texel[2]));
+
+        if (((median > 0.5f) && (coverage[i] < 32)) || ((median < 0.5f) && (coverage[i] > 223)))
+        {
+            for (int c = 0; c < 3; c++) texel[c] = 1.0f - texel[c];
+        }
+    }
+
+    RL_FREE(coverage);
+
+    // Error correction: texels whose channels interpolation with a neighbour texel produces a wrong median (clash),
+    // are set to their median (one channel SDF), losing corner sharpness only where required
+    float threshold = 1.001f/range;
+    unsigned char *clashes = (unsigned char *)RL_CALLOC((*width)*(*height), 1);
+
+    for (int y = 0; y < *height; y++)
+    {
+        for (int x = 0; x < *width; x++)
+        {
+            const int neighbours[4][2] = { { x - 1, y }, { x + 1, y }, { x, y - 1 }, { x, y + 1 } };
+
+            for (int n = 0; (n < 4) && !clashes[y*(*width) + x]; n++)
+            {
+                if ((neighbours[n][0] < 0) || (neighbours[n][0] >= *width) || (neighbours[n][1] < 0) || (neighbours[n][1] >= *height)) continue;
+
+                // Sort channels pairs by absolute difference, biggest first
+                float a[3] = { 0 };
+                float b[3] = { 0 };
+                memcpy(a, &field[(y*(*width) + x)*3], 3*sizeof(float));
+                memcpy(b, &field[(neighbours[n][1]*(*width) + neighbours[n][0])*3], 3*sizeof(float));
+
+                for (int i = 0; i < 2; i++)
+                {
+                    for (int j = 0; j < 2 - i; j++)
+                    {
+                        if (fabsf(b[j] - a[j]) < fabsf(b[j + 1] - a[j + 1]))
+                        {
+                            float tmp = a[j]; a[j] = a[j + 1]; a[j + 1] = tmp;
+                            tmp = b[j]; b[j] = b[j + 1]; b[j + 1] = tmp;
+                        }
+                    }
+                }
+
+                // Clash: two channels change more than a pixel distance, only flagged on texel farther from edge
+                if ((fabsf(b[1] - a[1]) >= threshold) && !((b[0] == b[1]) && (b[0] == b[2])) && (fabsf(a[2] - 0.5f) >= fabsf(b[2] - 0.5f))) clashes[y*(*width) + x] = 1;
+            }
+        }
+    }
+
+    data = (unsigned char *)RL_MALLOC((*width)*(*height)*3);
+
+    for (int i = 0; i < (*width)*(*height); i++)
+    {
+        float *texel = &field[i*3];
+
+        if (clashes[i])
+        {
+            float median = fmaxf(fminf(texel[0], texel[1]), fminf(fmaxf(texel[0], texel[1]), texel[2]));
+            texel[0] = texel[1] = texel[2] = median;
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            float value = texel[c];
+            if (value < 0.0f) value = 0.0f;
+            else if (value > 1.0f) value = 1.0f;
+
+            data[i*3 + c] = (unsigned char)(value*255.0f + 0.5f);
+        }
+    }
+
+    RL_FREE(clashes);
+    RL_FREE(field);
+
+    return data;
+}
+
+// Set MSDF contour edges colors, contour edges are [start..edgeCount)
+// NOTE: Contour must be the last one, teardrop contours with less than three edges are split in thirds
+static void SetMsdfContourColors(MsdfEdge *edges, int *edgeCount, int start)
+{
+    const int cyan = 6, magenta = 5, yellow = 3, white = 7;
+    float crossThreshold = sinf(FONT_MSDF_CORNER_ANGLE);
+    int count = *edgeCount - start;
+    int corners[3] = { 0 };     // First corners found, only three required
+    int cornerCount = 0;
+
+    // Find contour corners: edges direction changes sharply
+    Vector2 prevDir = GetMsdfEdgeDirection(&edges[*edgeCount - 1], 1.0f);
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 dir = GetMsdfEdgeDirection(&edges[start + i], 0.0f);
+        float prevLength = sqrtf(prevDir.x*prevDir.x + prevDir.y*prevDir.y);
+        float length = sqrtf(dir.x*dir.x + dir.y*dir.y);
+        float dot = (prevDir.x*dir.x + prevDir.y*dir.y)/(prevLength*length);
+        float cross = (prevDir.x*dir.y - prevDir.y*dir.x)/(prevLength*length);
+
+        if ((dot <= 0.0f) || (fabsf(cross) > crossThreshold))
+        {
+            if (cornerCount < 3) corners[cornerCount] = i;
+            cornerCount++;
+        }
+
+        prevDir = GetMsdfEdgeDirection(&edges[start + i], 1.0f);
+    }
+
+    if (cornerCount == 0)
+    {
+        // Smooth contour: all channels use all edges
+        for (int i = 0; i < count; i++) edges[start + i].color = white;
+    }
+    else if (cornerCount == 1)
+    {
+        // Teardrop contour: one corner, three colors spread along contour
+        const int colors[3] = { cyan, white, magenta };
+
+        if (count >= 3)
+        {
+            for (int i = 0; i < count; i++) edges[start + (corners[0] + i)%count].color = colors[(int)(3 + 2.875f*i/(count - 1) - 1.4375f + 0.5f) - 2];
+        }
+        else
+        {
+            // Split edges in thirds, starting at corner edge
+            MsdfEdge contour[2] = { edges[start + corners[0]], edges[start + (corners[0] + 1)%count] };
+
+            for (int i = 0; i < count; i++)
+            {
+                MsdfEdge rest = { 0 };
+                SplitMsdfEdge(&contour[i], 1.0f/3.0f, &edges[start + i*3], &rest);
+                SplitMsdfEdge(&rest, 0.5f, &edges[start + i*3 + 1], &edges[start + i*3 + 2]);
+            }
+
+            *edgeCount = start + count*3;
+
+            for (int i = 0; i < count*3; i++) edges[start + i].color = colors[(count == 1)? i : i/2];
+        }
+    }
+    else
+    {
+        // Multiple corners: color changes at every corner, last spline color must differ from first one
+        int color = cyan;
+        int spline = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            int index = (corners[0] + i)%count;
+
+            if (i > 0)
+            {
+                // Check if edge starts at a corner (corners could be more than stored, so check direction again)
+                Vector2 prev = GetMsdfEdgeDirection(&edges[start + (index + count - 1)%count], 1.0f);
+                Vector2 dir = GetMsdfEdgeDirection(&edges[start + index], 0.0f);
+                float prevLength = sqrtf(prev.x*prev.x + prev.y*prev.y);
+                float length = sqrtf(dir.x*dir.x + dir.y*dir.y);
+                float dot = (prev.x*dir.x + prev.y*dir.y)/(prevLength*length);
+                float cross = (prev.x*dir.y - prev.y*dir.x)/(prevLength*length);
+
+                if ((dot <= 0.0f) || (fabsf(cross) > crossThreshold))
+                {
+                    spline++;
+
+                    // Switch color, last spline avoids first spline color (cyan)
+                    if (spline == cornerCount - 1) color = (color == magenta)? yellow : magenta;
+                    else color = (color == cyan)? magenta : cyan;
+                }
+            }
+
+            edges[start + index].color = color;
+        }
+    }
+}
+
+// Split MSDF edge at parameter t (de Casteljau)
+static void SplitMsdfEdge(const MsdfEdge *edge, float t, MsdfEdge *left, MsdfEdge *right)
+{
+    Vector2 points[4] = { 0 };
+    int count = edge->pointCount;
+    memcpy(points, edge->p, count*sizeof(Vector2));
+
+    left->pointCount = right->pointCount = count;
+    left->color = right->color = edge->color;
+
+    for (int k = 0; k < count; k++)
+    {
+        left->p[k] = points[0];
+        right->p[count - 1 - k] = points[count - 1 - k];
+
+        for (int j = 0; j < count - 1 - k; j++)
+        {
+            points[j].x += (points[j + 1].x - points[j].x)*t;
+            points[j].y += (points[j + 1].y - points[j].y)*t;
+        }
+    }
+}
+
+// Get MSDF edge point at parameter t
+static Vector2 GetMsdfEdgePoint(const MsdfEdge *edge, float t)
+{
+    Vector2 points[4] = { 0 };
+    int count = edge->pointCount;
+    memcpy(points, edge->p, count*sizeof(Vector2));
+
+    for (int k = count - 1; k > 0; k--)
+    {
+        for (int j = 0; j < k; j++)
+        {
+            points[j].x += (points[j + 1].x - points[j].x)*t;
+            points[j].y += (points[j + 1].y - points[j].y)*t;
+        }
+    }
+
+    return points[0];
+}
+
+// Get MSDF edge direction at parameter t (not normalized)
+static Vector2 GetMsdfEdgeDirection(const MsdfEdge *edge, float t)
+{
+    const Vector2 *p = edge->p;
+    Vector2 dir = { p[1].x - p[0].x, p[1].y - p[0].y };
+
+    if (edge->pointCount == 3)
+    {
+        dir.x += ((p[2].x - p[1].x) - dir.x)*t;
+        dir.y += ((p[2].y - p[1].y) - dir.y)*t;
+
+        if ((dir.x == 0.0f) && (dir.y == 0.0f)) dir = (Vector2){ p[2].x - p[0].x, p[2].y - p[0].y };
+    }
+    else if (edge->pointCount == 4)
+    {
+        Vector2 ab = dir;
+        Vector2 bc = { p[2].x - p[1].x, p[2].y - p[1].y };
+        Vector2 cd = { p[3].x - p[2].x, p[3].y - p[2].y };
+        Vector2 abc = { ab.x + (bc.x - ab.x)*t, ab.y + (bc.y - ab.y)*t };
+        Vector2 bcd = { bc.x + (cd.x - bc.x)*t, bc.y + (cd.y - bc.y)*t };
+        dir = (Vector2){ abc.x + (bcd.x - abc.x)*t, abc.y + (bcd.y - abc.y)*t };
+
+        if ((dir.x == 0.0f) && (dir.y == 0.0f))
+        {
+            if (t == 0.0f) dir = (Vector2){ p[2].x - p[0].x, p[2].y - p[0].y };
+            else if (t == 1.0f) dir = (Vector2){ p[3].x - p[1].x, p[3].y - p[1].y };
+        }
+    }
+
+    return dir;
+}
+
+// Get MSDF signed distance from point to edge, param is the edge parameter of the closest point
+// NOTE: Param is out of [0..1] range when closest point is an edge end, required for pseudo-distance
+static MsdfDistance GetMsdfEdgeDistance(const MsdfEdge *edge, Vector2 origin, float *param)
+{
+    #define MSDF_CROSS(a, b) ((a).x*(b).y - (a).y*(b).x)
+    #define MSDF_DOT(a, b) ((a).x*(b).x + (a).y*(b).y)
+    #define MSDF_SIGN(n) (((n) > 0.0f)? 1.0f : -1.0f)
+
+    const Vector2 *p = edge->p;
+    const int last = edge->pointCount - 1;
+    Vector2 qa = { p[0].x - origin.x, p[0].y - origin.y };
+    Vector2 ab = { p[1].x - p[0].x, p[1].y - p[0].y };
+    float minDistance = 0.0f;
+
+    if (edge->pointCount == 2)
+    {
+        Vector2 aq = { -qa.x, -qa.y };
+        *param = MSDF_DOT(aq, ab)/MSDF_DOT(ab, ab);
+
+        Vector2 eq = (*param > 0.5f)? (Vector2){ p[1].x - origin.x, p[1].y - origin.y } : qa;
+        float endpointDistance = sqrtf(MSDF_DOT(eq, eq));
+
+        if ((*param > 0.0f) && (*param < 1.0f))
+        {
+            float orthoDistance = MSDF_CROSS(aq, ab)/sqrtf(MSDF_DOT(ab, ab));
+            if (fabsf(orthoDistance) < endpointDistance) return (MsdfDistance){ orthoDistance, 0.0f };
+        }
+
+        minDistance = MSDF_SIGN(MSDF_CROSS(aq, ab))*endpointDistance;
+    }
+    else
+    {
+        // Closest edge end
+        Vector2 dir = GetMsdfEdgeDirection(edge, 0.0f);
+        minDistance = MSDF_SIGN(MSDF_CROSS(dir, qa))*sqrtf(MSDF_DOT(qa, qa));
+        *param = -MSDF_DOT(qa, dir)/MSDF_DOT(dir, dir);
+
+        Vector2 qe = { p[last].x - origin.x, p[last].y - origin.y };
+        float distance = sqrtf(MSDF_DOT(qe, qe));
+
+        if (distance < fabsf(minDistance))
+        {
+            dir = GetMsdfEdgeDirection(edge, 1.0f);
+            minDistance = MSDF_SIGN(MSDF_CROSS(dir, qe))*distance;
+            *param = 1.0f + (-MSDF_DOT(qe, dir))/MSDF_DOT(dir, dir);
+        }
+
+        Vector2 br = { p[2].x - p[1].x - ab.x, p[2].y - p[1].y - ab.y };
+
+        if (edge->pointCount == 3)
+        {
+            // Quadratic bezier: closest point solving cubic equation
+            float t[3] = { 0 };
+            int solutions = SolveMsdfCubic(t, MSDF_DOT(br, br), 3.0f*MSDF_DOT(ab, br), 2.0f*MSDF_DOT(ab, ab) + MSDF_DOT(qa, br), MSDF_DOT(qa, ab));
+
+            for (int i = 0; i < solutions; i++)
+            {
+                if ((t[i] > 0.0f) && (t[i] < 1.0f))
+                {
+                    Vector2 qt = { qa.x + 2.0f*t[i]*ab.x + t[i]*t[i]*br.x, qa.y + 2.0f*t[i]*ab.y + t[i]*t[i]*br.y };
+                    Vector2 tangent = { ab.x + t[i]*br.x, ab.y + t[i]*br.y };
+                    distance = sqrtf(MSDF_DOT(qt, qt));
+
+                    if (distance <= fabsf(minDistance))
+                    {
+                        minDistance = MSDF_SIGN(MSDF_CROSS(tangent, qt))*distance;
+                        *param = t[i];
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Cubic bezier: closest point with Newton iterations from several starting points
+            Vector2 as = { (p[3].x - p[2].x) - (p[2].x - p[1].x) - br.x, (p[3].y - p[2].y) - (p[2].y - p[1].y) - br.y };
+
+            for (int i = 0; i <= 4; i++)
+            {
+                float t = (float)i/4.0f;
+                Vector2 qt = { qa.x + 3.0f*t*ab.x + 3.0f*t*t*br.x + t*t*t*as.x, qa.y + 3.0f*t*ab.y + 3.0f*t*t*br.y + t*t*t*as.y };
+
+                for (int step = 0; step < 4; step++)
+                {
+                    Vector2 d1 = { 3.0f*ab.x + 6.0f*t*br.x + 3.0f*t*t*as.x, 3.0f*ab.y + 6.0f*t*br.y + 3.0f*t*t*as.y };
+                    Vector2 d2 = { 6.0f*br.x + 6.0f*t*as.x, 6.0f*br.y + 6.0f*t*as.y };
+                    t -= MSDF_DOT(qt, d1)/(MSDF_DOT(d1, d1) + MSDF_DOT(qt, d2));
+                    if ((t <= 0.0f) || (t >= 1.0f)) break;
+
+                    qt = (Vector2){ qa.x + 3.0f*t*ab.x + 3.0f*t*t*br.x + t*t*t*as.x, qa.y + 3.0f*t*ab.y + 3.0f*t*t*br.y + t*t*t*as.y };
+                    distance = sqrtf(MSDF_DOT(qt, qt));
+
+                    if (distance < fabsf(minDistance))
+                    {
+                        minDistance = MSDF_SIGN(MSDF_CROSS(d1, qt))*distance;
+                        *param = t;
+                    }
+                }
+            }
+        }
+
+        if ((*param >= 0.0f) && (*param <= 1.0f)) return (MsdfDistance){ minDistance, 0.0f };
+    }
+
+    // Closest point is an edge end, dot breaks ties between edges sharing it
+    Vector2 dir = GetMsdfEdgeDirection(edge, (*param < 0.5f)? 0.0f : 1.0f);
+    Vector2 qe = (*param < 0.5f)? qa : (Vector2){ p[last].x - origin.x, p[last].y - origin.y };
+    float length = sqrtf(MSDF_DOT(dir, dir))*sqrtf(MSDF_DOT(qe, qe));
+    float dot = (length > 0.0f)? fabsf(MSDF_DOT(dir, qe))/length : 0.0f;
+
+    #undef MSDF_CROSS
+    #undef MSDF_DOT
+    #undef MSDF_SIGN
+
+    return (MsdfDistance){ minDistance, dot };
+}
+
+// Solve cubic equation: a*x^3 + b*x^2 + c*x + d = 0, returns real solutions count
+static int SolveMsdfCubic(float *x, float a, float b, float c, float d)
+{
+    if ((a != 0.0f) && (fabsf(b/a) < 1e6f))
+    {
+        // Normalized cubic: x^3 + a*x^2 + b*x + c = 0
+        float an = b/a, bn = c/a, cn = d/a;
+        float a2 = an*an;
+        float q = (a2 - 3.0f*bn)/9.0f;
+        float r = (an*(2.0f*a2 - 9.0f*bn) + 27.0f*cn)/54.0f;
+        float r2 = r*r;
+        float q3 = q*q*q;
+        an /= 3.0f;
+
+        if (r2 < q3)
+        {
+            float t = r/sqrtf(q3);
+            if (t < -1.0f) t = -1.0f;
+            if (t > 1.0f) t = 1.0f;
+            t = acosf(t);
+            q = -2.0f*sqrtf(q);
+            x[0] = q*cosf(t/3.0f) - an;
+            x[1] = q*cosf((t + 2.0f*PI)/3.0f) - an;
+            x[2] = q*cosf((t - 2.0f*PI)/3.0f) - an;
+
+            return 3;
+        }
+        else
+        {
+            float u = ((r < 0.0f)? 1.0f : -1.0f)*powf(fabsf(r) + sqrtf(r2 - q3), 1.0f/3.0f);
+            float v = (u == 0.0f)? 0.0f : q/u;
+            x[0] = (u + v) - an;
+
+            if ((u == v) || (fabsf(u - v) < 1e-6f*fabsf(u + v)))
+            {
+                x[1] = -0.5f*(u + v) - an;
+                return 2;
+            }
+
+            return 1;
+        }
+    }
+
+    // Quadratic equation: b*x^2 + c*x + d = 0
+    if ((b == 0.0f) || (fabsf(c) > 1e12f*fabsf(b)))
+    {
+        if (c == 0.0f) return 0;
+        x[0] = -d/c;
+        return 1;
+    }
+
+    float discriminant = c*c - 4.0f*b*d;
+
+    if (discriminant > 0.0f)
+    {
+        discriminant = sqrtf(discriminant);
+        x[0] = (-c + discriminant)/(2.0f*b);
+        x[1] = (-c - discriminant)/(2.0f*b);
+        return 2;
+    }
+    else if (discriminant == 0.0f)
+    {
+        x[0] = -c/(2.0f*b);
+        return 1;
+    }
+
+    return 0;
+}
+#endif
+
+// Get text layout from cache, laid out on a miss
+// NOTE: Returned layout is valid until next cache miss, it could evict the layout
+static TextLayout *GetTextLayoutCached(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayoutCache *cache = &textLayoutCache;
+    int textSize = TextLength(text);
+
+    // Compute FNV-1a hash of text and layout parameters
+    unsigned int fontSizeBits = 0;
+    unsigned int spacingBits = 0;
+    memcpy(&fontSizeBits, &fontSize, sizeof(float));
+    memcpy(&spacingBits, &spacing, sizeof(float));
+
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < textSize; i++) hash = (hash ^ (unsigned char)text[i])*16777619u;
+    hash = (hash ^ (unsigned int)(size_t)font.glyphs)*16777619u;
+    hash = (hash ^ font.texture.id)*16777619u;
+    hash = (hash ^ fontSizeBits)*16777619u;
+    hash = (hash ^ spacingBits)*16777619u;
+
+    int bucket = (int)(hash & (unsigned int)(cache->bucketCount - 1));
+    int entry = cache->buckets[bucket];
+
+    while (entry >= 0)
+    {
+        TextLayoutCacheEntry *e = &cache->entries[entry];
+
+        if ((e->hash == hash) && (e->textSize == textSize) && (e->glyphs == font.glyphs) && (e->textureId == font.texture.id) &&
+            (e->fontSize == fontSize) && (e->spacing == spacing) && (memcmp(e->text, text, textSize) == 0)) break;
+
+        entry = e->chain;
+    }
+
+    if (entry >= 0)
+    {
+        cache->stats.hits++;
+
+        // Move entry to LRU list head
+        if (entry != cache->head)
+        {
+            TextLayoutCacheEntry *e = &cache->entries[entry];
+
+            cache->entries[e->prev].next = e->next;
+            if (e->next >= 0) cache->entries[e->next].prev = e->prev;
+            else cache->tail = e->prev;
+
+            e->prev = -1;
+            e->next = cache->head;
+            cache->entries[cache->head].prev = entry;
+            cache->head = entry;
+        }
+    }
+    else
+    {
+        cache->stats.misses++;
+
+        if (cache->count < cache->stats.capacity) entry = cache->count++;
+        else
+        {
+            // Cache is full, least recently used entry is evicted and reused
+            entry = cache->tail;
+            TextLayoutCacheEntry *e = &cache->entries[entry];
+
+            int *link = &cache->buckets[e->hash & (unsigned int)(cache->bucketCount - 1)];
+            while (*link != entry) link = &cache->entries[*link].chain;
+            *link = e->chain;
+
+            cache->tail = e->prev;
+            if (cache->tail >= 0) cache->entries[cache->tail].next = -1;
+            else cache->head = -1;
+
+            UnloadTextLayout(e->layout);
+            RL_FREE(e->text);
+            cache->stats.evictions++;
+        }
+
+        TextLayoutCacheEntry *e = &cache->entries[entry];
+
+        e->hash = hash;
+        e->text = (char *)RL_MALLOC(textSize + 1);
+        memcpy(e->text, text, textSize + 1);
+        e->textSize = textSize;
+        e->glyphs = font.glyphs;
+        e->textureId = font.texture.id;
+        e->fontSize = fontSize;
+        e->spacing = spacing;
+        e->layout = LoadTextLayout(font, text, fontSize, spacing);
+
+        e->chain = cache->buckets[bucket];
+        cache->buckets[bucket] = entry;
+
+        e->prev = -1;
+        e->next = cache->head;
+        if (cache->head >= 0) cache->entries[cache->head].prev = entry;
+        else cache->tail = entry;
+        cache->head = entry;
+    }
+
+    return &cache->entries[entry].layout;
+}
+
+// Clear text layouts cache entries (capacity and stats kept)
+static void ClearTextLayoutCache(void)
+{
+    for (int i = 0; i < textLayoutCache.count; i++)
+    {
+        UnloadTextLayout(textLayoutCache.entries[i].layout);
+        RL_FREE(textLayoutCache.entries[i].text);
+    }
+
+    for (int i = 0; i < textLayoutCache.bucketCount; i++) textLayoutCache.buckets[i] = -1;
+
+    textLayoutCache.count = 0;
+    textLayoutCache.head = -1;
+    textLayoutCache.tail = -1;
+}
+
+// Wrap text box lines, from a paragraph first line to text end
+// NOTE: Lines before firstLine are kept, they are not measured again
+static void WrapTextBoxLines(TextBox *box, int firstLine)
+{
+    TextBoxData *data = (TextBoxData *)box->lineData;
+    Font font = box->font;
+    float scaleFactor = box->fontSize/font.baseSize;
+
+    int lineStart = ((firstLine > 0) && (firstLine < box->lineCount))? data->lines[firstLine].start : 0;
+    if (lineStart == 0) firstLine = 0;
+
+    box->lineCount = firstLine;
+    data->paragraphLine = firstLine;
+
+    int i = lineStart;
+    float offsetX = 0.0f;           // Current glyph position in line
+    int contentEnd = lineStart;     // Line last non-space glyph end
+    float contentWidth = 0.0f;      // Line width up to last non-space glyph
+    int breakStart = -1;            // Next line start at last break opportunity
+    int breakEnd = lineStart;       // Line end at last break opportunity
+    float breakWidth = 0.0f;        // Line width at last break opportunity
+    int prevIndex = -1;
+    bool prevSpace = false;
+    bool prevWide = false;
+
+    while (true)
+    {
+        bool lineBreak = ((i >= box->textSize) || (box->text[i] == '\n'));
+        int nextStart = -1;
+        int lineEnd = contentEnd;
+        float lineWidth = contentWidth;
+
+        if (!lineBreak)
+        {
+            // NOTE: Decoding is limited to text size, a sequence truncated at text end is decoded as '?'
+            int codepoint = 0;
+            int next = i;
+            GetCodepointsNext(box->text, box->textSize, &next, &codepoint, 1);
+            int codepointByteCount = next - i;
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (prevIndex >= 0) offsetX += GetKerningAdvance(font.kerning, prevIndex, index)*scaleFactor;
+            prevIndex = index;
+
+            float advance = ((font.glyphs[index].advanceX == 0)? font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
+            bool space = ((codepoint == ' ') || (codepoint == '\t'));
+
+            // CJK characters (and full-width forms) can be broken at any character
+            bool wide = (((codepoint >= 0x2e80) && (codepoint <= 0x9fff)) || ((codepoint >= 0xf900) && (codepoint <= 0xfaff)) || ((codepoint >= 0xff00) && (codepoint <= 0xffef)));
+
+            if (!space)
+            {
+                // Break opportunity before this glyph: after spaces or around CJK characters
+                if ((prevSpace || wide || prevWide) && (contentEnd > lineStart))
+                {
+                    breakStart = i;
+                    breakEnd = contentEnd;
+                    breakWidth = contentWidth;
+                }
+
+                if ((box->width > 0.0f) && ((offsetX + advance) > box->width) && (contentEnd > lineStart))
+                {
+                    // Line wrapped at last break opportunity, words longer than width are broken here
+                    if (breakStart > lineStart)
+                    {
+                        nextStart = breakStart;
+                        lineEnd = breakEnd;
+                        lineWidth = breakWidth;
+                    }
+                    else nextStart = i;
+                }
+                else
+                {
+                    // Leading whitespace counts toward width, if first glyph does not fit after it,
+                    // whitespace is dropped (as whitespace at a line break) and glyph starts the line
+                    if ((box->width > 0.0f) && ((offsetX + advance) > box->width) && (i > lineStart))
+                    {
+                        lineStart = i;
+                        offsetX = 0.0f;
+                    }
+
+                    contentEnd = i + codepointByteCount;
+                    contentWidth = offsetX + advance;
+                }
+            }
+
+            if (nextStart < 0)
+            {
+                offsetX += (advance + box->spacing);
+                prevSpace = space;
+                prevWide = wide;
+                i += codepointByteCount;
+                continue;
+            }
+        }
+
+        if (box->lineCount >= data->lineCapacity)
+        {
+            data->lineCapacity = (data->lineCapacity > 0)? data->lineCapacity*2 : 16;
+            data->lines = (TextBoxLine *)RL_REALLOC(data->lines, data->lineCapacity*sizeof(TextBoxLine));
+        }
+
+        data->lines[box->lineCount].start = lineStart;
+        data->lines[box->lineCount].end = lineEnd;
+        data->lines[box->lineCount].width = lineWidth;
+        box->lineCount++;
+
+        if (lineBreak)
+        {
+            if (i >= box->textSize) break;
+
+            // New paragraph, appended text is wrapped from its first line
+            nextStart = i + 1;
+            data->paragraphLine = box->lineCount;
+        }
+
+        // Next line glyphs measured from its start (glyphs after a break opportunity are measured again)
+        i = nextStart;
+        lineStart = nextStart;
+        offsetX = 0.0f;
+        contentEnd = nextStart;
+        contentWidth = 0.0f;
+        breakStart = -1;
+        prevIndex = -1;
+        prevSpace = false;
+        prevWide = false;
+    }
+}
+
+// Get next codepoints from UTF-8 text (up to maxCount), position moved, returns codepoints count
+// NOTE: Codepoints match GetCodepointNext() (continuation bytes are not validated), a '?' moves one byte
+// and a sequence truncated at text end is decoded as '?', ASCII bytes are decoded in blocks
+static int GetCodepointsNext(const char *text, int size, int *position, int *codepoints, int maxCount)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int i = *position;
+    int count = 0;
+
+    while ((i < size) && (count < maxCount))
+    {
+        if (bytes[i] < 0x80)
+        {
+            // ASCII blocks: 8 bytes checked at once
+            while (((i + 8) <= size) && ((count + 8) <= maxCount))
+            {
+                unsigned long long block = 0;
+                memcpy(&block, bytes + i, 8);
+                if ((block & 0x8080808080808080ULL) != 0) break;    // Non-ASCII byte in block
+
+                for (int k = 0; k < 8; k++) codepoints[count + k] = bytes[i + k];
+
+                i += 8;
+                count += 8;
+            }
+
+            // Remaining ASCII bytes, up to next non-ASCII byte
+            while ((i < size) && (count < maxCount) && (bytes[i] < 0x80)) codepoints[count++] = bytes[i++];
+        }
+        else
+        {
+            // Multi-byte sequences, decoded up to next ASCII byte
+            while ((i < size) && (count < maxCount) && (bytes[i] >= 0x80))
+            {
+                int codepointSize = 0;
+                int codepoint = 0x3f;   // Sequence truncated at text end
+
+                if ((i + 4) > size)
+                {
+                    // Near text end, sequence bytes are not read past text end
+                    int sequenceSize = ((bytes[i] & 0xf8) == 0xf0)? 4 : ((bytes[i] & 0xf0) == 0xe0)? 3 : ((bytes[i] & 0xe0) == 0xc0)? 2 : 1;
+                    if ((i + sequenceSize) <= size) codepoint = GetCodepointNext(text + i, &codepointSize);
+                }
+                else codepoint = GetCodepointNext(text + i, &codepointSize);
+
+                // NOTE: Bad bytes are decoded using the '?' symbol moving one byte (as text drawing)
+                if (codepoint == 0x3f) codepointSize = 1;
+
+                codepoints[count++] = codepoint;
+                i += codepointSize;
+            }
+        }
+    }
+
+    *position = i;
+
+    return count;
+}
+
+// Get text ASCII bytes count from start (bytes < 0x80)
+// NOTE: Bytes are checked in blocks, 8 bytes at once
+static int GetTextAsciiLength(const char *text, int size)
+{
+    int length = 0;
+
+    for (; (length + 8) <= size; length += 8)
+    {
+        unsigned long long block = 0;
+        memcpy(&block, text + length, 8);
+        if ((block & 0x8080808080808080ULL) != 0) break;
+    }
+
+    while ((length < size) && ((unsigned char)text[length] < 0x80)) length++;
+
+    return length;
+}
+
+#if defined(SUPPORT_FONT_GLYPH_CACHE)
+// Get glyph cache slot for codepoint, rasterizing glyph on a miss
+// NOTE: Returned slot is valid until next cache miss, it could evict the glyph
+static int GetGlyphCacheIndex(GlyphCache *cache, int codepoint)
+{
+    unsigned int mask = (unsigned int)cache->tableSize - 1;
+    unsigned int hash = ((unsigned int)codepoint*2654435761u) & mask;
+
+    // Lookup codepoint in hash table (linear probing)
+    while (cache->table[hash] >= 0)
+    {
+        int slot = cache->table[hash];
+
+        if (cache->glyphs[slot].value == codepoint)
+        {
+            if (cache->slotPages[slot] >= 0) cache->pages[cache->slotPages[slot]].lastUse = ++cache->useCounter;
+            cache->stats.hits++;
+
+            return slot;
+        }
+
+        hash = (hash + 1) & mask;
+    }
+
+    cache->stats.misses++;
+
+    // Codepoints not available in font fallback to '?', as static fonts do
+    if ((codepoint != GLYPH_NOTFOUND_CHAR_FALLBACK) && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0)) return GetGlyphCacheIndex(cache, GLYPH_NOTFOUND_CHAR_FALLBACK);
+
+    // Get a free slot, evicting least recently used page glyphs if all slots are used
+    while (cache->freeCount == 0)
+    {
+        int lruPage = -1;
+
+        for (int i = 0; i < cache->pageCount; i++)
+        {
+            if ((cache->pages[i].glyphCount > 0) && ((lruPage < 0) || (cache->pages[i].lastUse < cache->pages[lruPage].lastUse))) lruPage = i;
+        }
+
+        EvictGlyphCachePage(cache, lruPage);
+    }
+
+    int slot = cache->freeSlots[--cache->freeCount];
+
+    // Rasterize glyph, same metrics as LoadFontData()
+    GlyphInfo glyph = { 0 };
+    int width = 0, height = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&cache->fontInfo, cache->scaleFactor, cache->scaleFactor, codepoint, &width, &height, &glyph.offsetX, &glyph.offsetY);
+
+    glyph.value = codepoint;
+    glyph.offsetY += cache->ascent;
+    stbtt_GetCodepointHMetrics(&cache->fontInfo, codepoint, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*cache->scaleFactor);
+
+    Rectangle rec = { 0 };
+    int page = -1;
+
+    if ((bitmap != NULL) && (width > 0) && (height > 0))
+    {
+        page = LoadGlyphCacheRegion(cache, width, height, &rec);
+
+        if (page >= 0)
+        {
+            GlyphCachePage *cachePage = &cache->pages[page];
+            unsigned char *pixels = (unsigned char *)cachePage->image.data;
+
+            // Copy glyph pixels into page atlas, converting GRAYSCALE to GRAY_ALPHA
+            for (int y = 0; y < height; y++)
+            {
+                unsigned char *row = pixels + (((int)rec.y + y)*cachePage->image.width + (int)rec.x)*2;
+
+                for (int x = 0; x < width; x++)
+                {
+                    row[x*2] = 255;
+                    row[x*2 + 1] = bitmap[y*width + x];
+                }
+            }
+
+            // Update page dirty region, including glyph padding (it could contain evicted glyphs pixels on texture)
+            Rectangle region = { rec.x - FONT_TTF_DEFAULT_CHARS_PADDING, rec.y - FONT_TTF_DEFAULT_CHARS_PADDING,
+                                 rec.width + 2*FONT_TTF_DEFAULT_CHARS_PADDING, rec.height + 2*FONT_TTF_DEFAULT_CHARS_PADDING };
+
+            if (cachePage->dirty.width > 0)
+            {
+                float right = cachePage->dirty.x + cachePage->dirty.width;
+                float bottom = cachePage->dirty.y + cachePage->dirty.height;
+
+                if ((region.x + region.width) > right) right = region.x + region.width;
+                if ((region.y + region.height) > bottom) bottom = region.y + region.height;
+                if (region.x < cachePage->dirty.x) cachePage->dirty.x = region.x;
+                if (region.y < cachePage->dirty.y) cachePage->dirty.y = region.y;
+
+                cachePage->dirty.width = right - cachePage->dirty.x;
+                cachePage->dirty.height = bottom - cachePage->dirty.y;
+            }
+            else cachePage->dirty = region;
+
+            // Glyph image required by ImageDrawText()
+            glyph.image = ImageFromImage(cachePage->image, rec);
+
+            cachePage->glyphCount++;
+            cachePage->lastUse = ++cache->useCounter;
+        }
+        else TRACELOG(LOG_WARNING, "FONT: Glyph (%i) does not fit in glyph cache page (%ix%i)", codepoint, cache->pageSize, cache->pageSize);
+    }
+
+    stbtt_FreeBitmap(bitmap, NULL);
+
+    cache->glyphs[slot] = glyph;
+    cache->recs[slot] = rec;
+    cache->slotPages[slot] = page;
+
+    // Insert slot into hash table, probing from codepoint hash
+    hash = ((unsigned int)codepoint*2654435761u) & mask;
+    while (cache->table[hash] >= 0) hash = (hash + 1) & mask;
+    cache->table[hash] = slot;
+
+    return slot;
+}
+
+// Get glyph cache page texture for a glyph slot, uploading page changes
+// NOTE: Returns an empty texture for glyphs with no pixels
+static Texture2D GetGlyphCacheTexture(GlyphCache *cache, int index)
+{
+    Texture2D texture = { 0 };
+
+    if (cache->slotPages[index] >= 0)
+    {
+        GlyphCachePage *page = &cache->pages[cache->slotPages[index]];
+
+        // Upload page region with glyphs rasterized since last update
+        if (page->dirty.width > 0)
+        {
+            UpdateTextureRecView(page->texture, page->dirty, GetImageView(page->image, page->dirty));
+            page->dirty = (Rectangle){ 0 };
+        }
+
+        texture = page->texture;
+    }
+
+    return texture;
+}
+
+// Load a new empty atlas page into glyph cache
+static void LoadGlyphCachePage(GlyphCache *cache)
+{
+    GlyphCachePage *page = &cache->pages[cache->pageCount];
+
+    page->image.data = RL_CALLOC(cache->pageSize*cache->pageSize, 2);
+    page->image.width = cache->pageSize;
+    page->image.height = cache->pageSize;
+    page->image.mipmaps = 1;
+    page->image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    page->texture = LoadTextureFromImage(page->image);
+
+    page->nodes = (stbrp_node *)RL_MALLOC(cache->pageSize*sizeof(stbrp_node));
+    stbrp_init_target(&page->packer, cache->pageSize, cache->pageSize, page->nodes, cache->pageSize);
+
+    cache->pageCount++;
+}
+
+// Load atlas region for a glyph, evicting least recently used page if required
+// NOTE: Returns page index or -1 if glyph does not fit in a page, rec returned without padding
+static int LoadGlyphCacheRegion(GlyphCache *cache, int width, int height, Rectangle *rec)
+{
+    stbrp_rect rect = { 0 };
+    rect.w = width + 2*FONT_TTF_DEFAULT_CHARS_PADDING;
+    rect.h = height + 2*FONT_TTF_DEFAULT_CHARS_PADDING;
+    int page = -1;
+
+    if ((rect.w <= cache->pageSize) && (rect.h <= cache->pageSize))
+    {
+        // Skyline packing into first page with space available
+        for (int i = 0; i < cache->pageCount; i++)
+        {
+            if (stbrp_pack_rects(&cache->pages[i].packer, &rect, 1))
+            {
+                page = i;
+                break;
+            }
+        }
+
+        if (page < 0)
+        {
+            if (cache->pageCount < cache->maxPages)
+            {
+                LoadGlyphCachePage(cache);
+                page = cache->pageCount - 1;
+            }
+            else
+            {
+                // All pages full, least recently used page is evicted and reused
+                page = 0;
+                for (int i = 1; i < cache->pageCount; i++) if (cache->pages[i].lastUse < cache->pages[page].lastUse) page = i;
+
+                EvictGlyphCachePage(cache, page);
+            }
+
+            stbrp_pack_rects(&cache->pages[page].packer, &rect, 1);
+        }
+
+        rec->x = (float)(rect.x + FONT_TTF_DEFAULT_CHARS_PADDING);
+        rec->y = (float)(rect.y + FONT_TTF_DEFAULT_CHARS_PADDING);
+        rec->width = (float)width;
+        rec->height = (float)height;
+    }
+
+    return page;
+}
+
+// Evict all glyphs from an atlas page (-1 for glyphs with no pixels)
+// NOTE: Skyline packer can not free single regions, so the full page is reset
+static void EvictGlyphCachePage(GlyphCache *cache, int page)
+{
+    // Draw pending batch glyphs before page pixels are reused
+    if (page >= 0) rlDrawRenderBatchActive();
+
+    for (int i = 0; i < cache->slotCount; i++)
+    {
+        if (cache->slotPages[i] == page)
+        {
+            UnloadImage(cache->glyphs[i].image);
+            cache->glyphs[i] = (GlyphInfo){ 0 };
+            cache->recs[i] = (Rectangle){ 0 };
+            cache->slotPages[i] = -2;
+            cache->freeSlots[cache->freeCount++] = i;
+            cache->stats.evictions++;
+        }
+    }
+
+    if (page >= 0)
+    {
+        GlyphCachePage *cachePage = &cache->pages[page];
+
+        memset(cachePage->image.data, 0, cache->pageSize*cache->pageSize*2);
+        stbrp_init_target(&cachePage->packer, cache->pageSize, cache->pageSize, cachePage->nodes, cache->pageSize);
+        cachePage->glyphCount = 0;
+    }
+
+    // Rebuild hash table with remaining glyphs
+    unsigned int mask = (unsigned int)cache->tableSize - 1;
+    for (int i = 0; i < cache->tableSize; i++) cache->table[i] = -1;
+
+    for (int i = 0; i < cache->slotCount; i++)
+    {
+        if (cache->slotPages[i] != -2)
+        {
+            unsigned int hash = ((unsigned int)cache->glyphs[i].value*2654435761u) & mask;
+            while (cache->table[hash] >= 0) hash = (hash + 1) & mask;
+            cache->table[hash] = i;
+        }
+    }
+}
+
+// Unload glyph cache data and atlas pages
+// NOTE: Glyphs slots are font glyphs and recs, unloaded by UnloadFont()
+static void UnloadGlyphCache(GlyphCache *cache)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        UnloadImage(cache->pages[i].image);
+        UnloadTexture(cache->pages[i].texture);
+        RL_FREE(cache->pages[i].nodes);
+    }
+
+    RL_FREE(cache->pages);
+    RL_FREE(cache->slotPages);
+    RL_FREE(cache->freeSlots);
+    RL_FREE(cache->table);
+    RL_FREE(cache->fileData);
+    RL_FREE(cache);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
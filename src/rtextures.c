@@ -78,6 +78,7 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <time.h>               // Required for: time() [Used in GetImportTempFileName()]
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -114,7 +115,7 @@
 #if defined(SUPPORT_FILEFORMAT_PKM)
     #define RL_GPUTEX_SUPPORT_PKM
 #endif
-#if defined(SUPPORT_FILEFORMAT_KTX)
+#if defined(SUPPORT_FILEFORMAT_KTX) || defined(SUPPORT_TEXTURE_IMPORT_CACHE)
     #define RL_GPUTEX_SUPPORT_KTX
 #endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
@@ -152,7 +153,8 @@
      defined(SUPPORT_FILEFORMAT_PKM) || \
      defined(SUPPORT_FILEFORMAT_KTX) || \
      defined(SUPPORT_FILEFORMAT_PVR) || \
-     defined(SUPPORT_FILEFORMAT_ASTC))
+     defined(SUPPORT_FILEFORMAT_ASTC) || \
+     defined(SUPPORT_TEXTURE_IMPORT_CACHE))
 
     #define RL_GPUTEX_IMPLEMENTATION
     #include "external/rl_gputex.h"         // Required for: rl_load_xxx_from_memory()
@@ -176,6 +178,20 @@
 
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    #define RL_PNGSTREAM_MALLOC RL_MALLOC
+    #define RL_PNGSTREAM_CALLOC RL_CALLOC
+    #define RL_PNGSTREAM_FREE RL_FREE
+
+    #if !defined(SUPPORT_STANDARD_FILEIO)
+        #define RL_PNGSTREAM_NO_STDIO
+    #endif
+
+    #define RL_PNGSTREAM_IMPLEMENTATION
+    #include "external/rl_pngstream.h"      // Required for: rl_png_stream_open(), rl_png_stream_open_memory() [LoadTiledImage()]
+                                            // NOTE: Used to decode PNG images by rows, directly from file (or file data)
+#endif
+
 #if defined(SUPPORT_IMAGE_EXPORT)
     #define STBIW_MALLOC RL_MALLOC
     #define STBIW_FREE RL_FREE
@@ -185,13 +201,23 @@
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
 #endif
 
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+    #include "external/sdefl.h"             // Required for: sdefl_bound() [ExportImage()]
+    #include "external/rl_sdefl.h"          // Required for: rl_sdeflate_part() [ExportImage()]
+                                            // NOTE: Implementations included by rcore module
+#endif
+
 #if defined(SUPPORT_IMAGE_GENERATION)
     #define STB_PERLIN_IMPLEMENTATION
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
-#define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
-#define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
+// NOTE: Resize working memory is transient, allocated from image scratch arena if available
+static void *LoadImageScratch(int size);
+static void UnloadImageScratch(void *ptr);
+
+#define STBIR_MALLOC(size,c) ((void)(c), LoadImageScratch((int)(size)))
+#define STBIR_FREE(ptr,c) ((void)(c), UnloadImageScratch(ptr))
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 
@@ -206,25 +232,270 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef GEN_IMAGE_JOB_MIN_PIXELS
+    #define GEN_IMAGE_JOB_MIN_PIXELS  16384    // Minimum number of pixels generated by every worker job
+#endif
+
+// Minimum number of rows per worker job, small images are generated on calling thread
+#define GEN_IMAGE_JOB_ROWS(width) (1 + GEN_IMAGE_JOB_MIN_PIXELS/(((width) > 0)? (width) : 1))
+
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH     4096        // Maximum length for filepaths (import cache files)
+#endif
+
+#ifndef IMAGE_TRANSFORM_BLOCK_SIZE
+    #define IMAGE_TRANSFORM_BLOCK_SIZE  32      // Image transform block size (pixels), blocks are processed to keep data in cache
+#endif
+
+#ifndef PNG_EXPORT_PART_SIZE
+    #define PNG_EXPORT_PART_SIZE    262144      // PNG export filtered data part size, parts are compressed in parallel
+#endif
+
+#ifndef DITHER_BLUE_NOISE_SIZE
+    #define DITHER_BLUE_NOISE_SIZE      32      // Dithering blue noise mask size (pixels), generated on first use
+#endif
+
+#ifndef STREAM_TEXTURE_BUFFERS
+    #define STREAM_TEXTURE_BUFFERS       3      // Stream texture pixel unpack buffers ring size
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Animated image context type
+typedef enum {
+    ANIM_IMAGE_STATIC = 0,      // Single frame image (any supported format)
+    ANIM_IMAGE_GIF,             // Animated GIF, decoded with stb_image
+    ANIM_IMAGE_APNG             // Animated PNG, frames rebuilt as PNG and decoded with stb_image
+} AnimImageType;
+
+// Tiled image context type
+typedef enum {
+    TILED_IMAGE_FULL = 0,       // Full image loaded in memory, used for non-streamable formats
+    TILED_IMAGE_PNG_STREAM      // PNG decoded by rows from file (or file data, if custom file loader set)
+} TiledImageType;
+
+// Animated image decoder context
+typedef struct AnimImageContext {
+    unsigned char *fileData;    // Animation file data (compressed), owned by context
+    int dataSize;               // Animation file data size
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    stbi__context gifStream;    // GIF data stream
+    stbi__gif gif;              // GIF decoder state, gif.out contains current frame
+    unsigned char *gifPrevious; // GIF previous frame, required by "restore to previous" disposal
+    unsigned char *gifScratch;  // GIF current frame backup while next frame is decoded
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    int *pngFrameOffsets;       // APNG frame control chunks (fcTL) offsets
+    int pngHeaderOffset;        // APNG first chunk offset (IHDR)
+    int pngHeaderSize;          // APNG shared chunks size, from IHDR to first image data chunk (except animation chunks)
+    unsigned char *canvas;      // APNG output canvas (R8G8B8A8)
+    unsigned char *backup;      // APNG canvas region backup, required by "restore to previous" disposal
+    int disposeOp;              // APNG previous frame dispose operation
+    Rectangle disposeRec;       // APNG previous frame region
+#endif
+} AnimImageContext;
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image dithering job data, shared by all worker jobs (rows bands)
+typedef struct DitherJobData {
+    const unsigned char *data;  // Source pixel data
+    int format;                 // Source pixel format
+    int width;                  // Image width
+    int height;                 // Image height
+    unsigned short *pixels;     // Output pixels (16bpp)
+    int bits[4];                // Output channels bits (R, G, B, A)
+    int method;                 // Dithering method (DitherMethod)
+} DitherJobData;
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Image generation job data, shared by all worker jobs (rows bands)
+typedef struct GenImageJobData {
+    Color *pixels;              // Output pixels (R8G8B8A8)
+    int width;                  // Image width
+    int height;                 // Image height
+    Color col1;                 // First color (gradients, checked)
+    Color col2;                 // Second color (gradients, checked)
+    float factor;               // Generic factor (radial density, noise factor)
+    int offsetX;                // Noise offset X
+    int offsetY;                // Noise offset Y
+    float scale;                // Noise scale
+    int octaves;                // Noise octaves
+    float lacunarity;           // Noise lacunarity, frequency multiplier between octaves
+    float gain;                 // Noise gain, amplitude multiplier between octaves
+    unsigned int seed;          // Noise seed
+    int tileSizeX;              // Tile size X (checks, cells)
+    int tileSizeY;              // Tile size Y (checks, cells)
+    const Vector2 *seeds;       // Cellular seeds, one per tile
+    int seedsPerRow;            // Cellular seeds per row
+    int seedsPerCol;            // Cellular seeds per column
+} GenImageJobData;
+#endif
+
+// Alpha borders job data, shared by all worker jobs (rectangles or images ranges)
+typedef struct AlphaBorderJobData {
+    Image image;                // Source image (rectangles borders)
+    Rectangle *recs;            // Rectangles, replaced by their alpha borders
+    Image *images;              // Images to crop
+    float threshold;            // Alpha threshold
+} AlphaBorderJobData;
+
+// Image scratch block header, blocks are stacked in scratch arena (or allocated from heap)
+// NOTE: Header size keeps blocks data aligned to 16 bytes
+typedef struct ImageScratchBlock {
+    int size;                   // Block size, including header
+    int previous;               // Previous block offset in arena (-1 if first block)
+    int freed;                  // Block freed, arena memory reclaimed once all blocks above are freed
+    int padding;                // Padding for data alignment
+} ImageScratchBlock;
+
+// Load images job data, shared by all worker items (one image per item)
+typedef struct LoadImagesJobData {
+    const char **fileNames;             // Files to load (NULL if loading from memory buffers)
+    const char **fileTypes;             // Memory buffers file types, i.e. '.png'
+    const unsigned char **fileData;     // Memory buffers data
+    const int *dataSizes;               // Memory buffers data sizes
+    Image *images;                      // Loaded images, in input order
+} LoadImagesJobData;
+
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+// Import directory job data, shared by all worker jobs (files ranges)
+typedef struct ImportImageJobData {
+    FilePathList files;         // Files to import
+    int format;                 // Import pixel format (0 keeps source format)
+    unsigned int flags;         // Import flags (TextureImportFlags)
+    bool *results;              // Import result per file
+} ImportImageJobData;
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+// PNG encoding job data, shared by all worker jobs (rows bands, data parts)
+typedef struct EncodePngJobData {
+    const unsigned char *pixels;    // Image pixels (8 bit per channel)
+    int width;                  // Image width
+    int height;                 // Image height
+    int channels;               // Image channels
+    int level;                  // Compression level (PngCompressionLevel)
+    int rowSize;                // Filtered row size, including filter type byte
+    unsigned char *filtered;    // Filtered rows data
+    int rowsPerPart;            // Filtered rows per compressed part
+    int partCount;              // Compressed parts count
+    unsigned char **parts;      // Compressed parts, stored as IDAT chunks
+    int *partSizes;             // Compressed parts size, including IDAT chunk header and CRC
+    unsigned int *partChecksums;    // Filtered data parts checksums (Adler-32)
+    bool failed;                // Any job failed to allocate its buffers, encoding aborted
+} EncodePngJobData;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+static char textureImportCachePath[MAX_FILEPATH_LENGTH] = { 0 };    // Import cache directory, LoadTexture() uses it if set
+static int textureImportFormat = 0;                                 // Import pixel format used by LoadTexture()
+static unsigned int textureImportFlags = 0;                         // Import flags used by LoadTexture()
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+static int pngCompressionLevel = PNG_COMPRESSION_DEFAULT;           // PNG export compression level
+#endif
+
+// Image scratch arena, transient buffers stack, protected by worker data lock
+static unsigned char *imageScratch = NULL;                          // Image scratch arena memory
+static int imageScratchLast = -1;                                   // Image scratch arena last block offset (-1 if empty)
+static ImageScratchStats imageScratchStats = { 0 };                 // Image scratch arena and transient memory stats
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static unsigned short ditherBlueNoise[DITHER_BLUE_NOISE_SIZE*DITHER_BLUE_NOISE_SIZE] = { 0 };   // Dithering blue noise mask, pixels rank
+static bool ditherBlueNoiseReady = false;                           // Dithering blue noise mask generated
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_MODULE_RTEXT)
+extern float GetTextLineSpacingFactor(void);    // Get text line spacing factor [module: text]
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
-static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized, scratch)
+static void GetPixelDataColors(const void *data, int count, int format, Color *colors);  // Get colors from pixel data, uncompressed formats only
+static void SetPixelDataColors(void *data, int count, int format, const Color *colors);  // Set pixel data from colors, uncompressed formats only (as ImageDrawPixel())
+static const Color *GetPixelRowColors(const void *data, int count, int format, Color *buffer);  // Get colors from pixel data row, converted into buffer if not R8G8B8A8
+static int GetAlphaRowFirst(const Color *pixels, int start, int end, unsigned char threshold);  // Get first pixel in range with alpha over threshold, end if none
+static int GetAlphaRowLast(const Color *pixels, int start, int end, unsigned char threshold);   // Get last pixel in range with alpha over threshold, start - 1 if none
+static void GetImageAlphaBordersJob(void *data, int start, int end);                           // Alpha borders job: get alpha border of a range of rectangles
+static Color *LoadImageScratchColors(Image image);                                             // Load image pixel data as transient Color buffer (scratch)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ImageAlphaCropBatchJob(void *data, int start, int end);                            // Alpha crop job: crop a range of images
+#endif
+
+static void LoadImagesJob(void *data, int start, int end);  // Load images job: load a range of images (files or memory buffers)
+static bool DecodeAnimImageFrame(AnimImage *anim);          // Decode next animation frame into anim->image
+static void ResetAnimImage(AnimImage *anim);                // Reset animation decoder to first frame (not decoded)
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize);  // Get GIF frames count, parsing blocks structure (no decoding)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static bool InitAnimPng(AnimImage *anim);                   // Init APNG frames index, returns false if PNG is not animated
+static bool DecodeAnimPngFrame(AnimImage *anim);            // Decode next APNG frame and compose it on canvas
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size);     // Compute Adler-32 checksum (zlib stream)
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2);         // Combine Adler-32 checksums of two consecutive data blocks
+static void FilterPngRow(unsigned char *output, const unsigned char *row, const unsigned char *prevRow, int size, int bpp, int filter);  // Filter PNG row data
+static unsigned int GetPngRowCost(const unsigned char *data, int size);                          // Get PNG filtered row cost (filter heuristic)
+static void EncodePngFilterJob(void *data, int startRow, int endRow);                            // PNG encoding job: filter a range of rows
+static void EncodePngDeflateJob(void *data, int start, int end);                                 // PNG encoding job: compress a range of data parts
+static unsigned char *EncodeImagePng(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize);   // Encode image pixels as PNG file data
+#endif
+
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+static unsigned long long ComputeImportHash(const unsigned char *data, unsigned int dataSize);   // Compute import cache hash for file data (FNV-1a 64-bit)
+static unsigned long long ComputeImportStamp(const char *fileName);                             // Compute import cache stamp for file: path, size and modification time
+static bool LoadImportCacheFile(const char *cacheFileName, Image *image);                       // Load image from import cache file, image is loaded only if required
+static void GetImportTempFileName(const char *fileName, char *tempFileName, int size);           // Get unique temporary file name for an import cache file
+static bool CommitImportCacheFile(const char *tempFileName, const char *fileName);               // Move temporary file into import cache (rename), removed on failure
+static void ProcessImportImage(Image *image, int format, unsigned int flags);                    // Apply import processing to image
+static bool ImportImageFile(const char *fileName, int format, unsigned int flags, Image *image); // Import image file through import cache
+static void ImportImageJob(void *data, int start, int end);                                     // Import directory job: import a range of files
+#endif
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void SetColorLUTIdentity(unsigned char lut[4][256]);                         // Set color lookup tables to identity
+static void SetColorLUTTint(unsigned char lut[4][256], Color color);                // Append tint to color lookup tables
+static void SetColorLUTContrast(unsigned char lut[4][256], float contrast);         // Append contrast to color lookup tables
+static void SetColorLUTBrightness(unsigned char lut[4][256], int brightness);       // Append brightness to color lookup tables
+static unsigned char GetColorLUTGray(unsigned char r, unsigned char g, unsigned char b);                // Get grayscale value for color (ImageFormat() conversion)
+static void ImageApplyColorLUT(Image *image, unsigned char lut[4][256], int grayscale);           // Apply color lookup tables to image
+static void ReverseImagePixels(unsigned char *data, int count, int bytesPerPixel);                  // Reverse pixels order in place
+static void TransposeImagePixels(unsigned char *data, int size, int bytesPerPixel);                 // Transpose square image pixels in place (by blocks)
+static void TransformImagePixels(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, int origin, int stepX, int stepY);  // Copy image pixels into transformed positions (by blocks)
+static void DitherOrderedJob(void *data, int startRow, int endRow);                 // Image dithering job: ordered dithering
+static void DitherErrorDiffusion(DitherJobData *job);                               // Image dithering: error diffusion (sequential)
+static void GenDitherBlueNoise(void);                                               // Generate dithering blue noise mask (void-and-cluster)
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenImageGradientVJob(void *data, int startRow, int endRow);         // Image generation job: vertical gradient
+static void GenImageGradientHJob(void *data, int startRow, int endRow);         // Image generation job: horizontal gradient
+static void GenImageGradientRadialJob(void *data, int startRow, int endRow);    // Image generation job: radial gradient
+static void GenImageCheckedJob(void *data, int startRow, int endRow);           // Image generation job: checked
+static void GenImageWhiteNoiseJob(void *data, int startRow, int endRow);        // Image generation job: white noise
+static void GenImagePerlinNoiseJob(void *data, int startRow, int endRow);       // Image generation job: perlin noise
+static void GenImageFractalNoiseJob(void *data, int startRow, int endRow);      // Image generation job: seeded fractal noise
+static void GenImageCellularJob(void *data, int startRow, int endRow);          // Image generation job: cellular
+#endif
+
+static int GetImagePixelData(Color color, int format, unsigned char *pixel);    // Get color formatted as pixel data, returns bytes per pixel (0 if not supported)
+static void ImageFillSpan(Image *dst, int startX, int endX, int y, const unsigned char *pixel, int bytesPerPixel);  // Fill clipped horizontal span [startX, endX) with pixel data
+static void ImageBlendSpan(Image *dst, int startX, int endX, int y, Color color);    // Alpha-blend color into clipped horizontal span [startX, endX)
+static void ImageFillPolygon(Image *dst, Vector2 *points, int pointCount, Color color);   // Fill polygon by scanlines, sampling at pixel centers (even-odd rule)
+static Rectangle GetTextureClippedRec(Texture2D texture, Rectangle rec);         // Get rectangle clipped to texture bounds, in whole pixels
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -326,7 +597,7 @@ Image LoadImageAnim(const char *fileName, int *frames)
         frameCount = 1;
     }
 
-    // TODO: Support APNG animated images
+    // NOTE: APNG animated images are supported by streaming API: LoadAnimImage()
 
     *frames = frameCount;
     return image;
@@ -457,6 +728,277 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     return image;
 }
 
+//------------------------------------------------------------------------------------
+// Tiled image loading functions
+//------------------------------------------------------------------------------------
+// Load tiled image source from file (no pixel data loaded)
+// NOTE: Non-interlaced PNG files are streamed by rows, decoder state is saved every checkpointRows rows
+// to seek regions fast (~36 KB per checkpoint), other formats are fully loaded in memory (fallback)
+// WARNING: PNG compressed data is read directly from file, but if a custom file loader is set
+// (SetLoadFileDataCallback()) or standard file io is not supported, file data is kept in memory
+TiledImage LoadTiledImage(const char *fileName, int checkpointRows)
+{
+    TiledImage tiled = { 0 };
+
+    tiled.checkpointRows = (checkpointRows > 0)? checkpointRows : 256;
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png"))
+    {
+        rl_png_stream *png = NULL;
+
+    #if defined(SUPPORT_STANDARD_FILEIO)
+        if (!IsLoadFileDataCallbackSet()) png = rl_png_stream_open(fileName, tiled.checkpointRows);
+        else
+    #endif
+        {
+            unsigned int dataSize = 0;
+            unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+            // NOTE: Stream takes file data ownership, freed on stream close
+            png = rl_png_stream_open_memory(fileData, (int)dataSize, tiled.checkpointRows);
+        }
+
+        if (png != NULL)
+        {
+            int channels = 0;
+            rl_png_stream_info(png, &tiled.width, &tiled.height, &channels);
+
+            if (channels == 1) tiled.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+            else if (channels == 2) tiled.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+            else if (channels == 3) tiled.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            else tiled.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            tiled.ctxType = TILED_IMAGE_PNG_STREAM;
+            tiled.ctxData = png;
+        }
+    }
+#endif
+
+    if (tiled.ctxData == NULL)
+    {
+        Image image = LoadImage(fileName);
+
+        if (image.data != NULL)
+        {
+            tiled.width = image.width;
+            tiled.height = image.height;
+            tiled.format = image.format;
+            tiled.ctxType = TILED_IMAGE_FULL;
+            tiled.ctxData = RL_MALLOC(sizeof(Image));
+            *((Image *)tiled.ctxData) = image;
+
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Tiled image can not be streamed, full image loaded", fileName);
+        }
+    }
+
+    if (tiled.ctxData != NULL) TRACELOG(LOG_INFO, "IMAGE: [%s] Tiled image loaded successfully (%ix%i | %s)", fileName, tiled.width, tiled.height, rlGetPixelFormatName(tiled.format));
+    else TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to load tiled image", fileName);
+
+    return tiled;
+}
+
+// Check if a tiled image source is ready
+bool IsTiledImageReady(TiledImage tiled)
+{
+    return ((tiled.ctxData != NULL) &&      // Validate decoder context
+            (tiled.width > 0) &&
+            (tiled.height > 0) &&           // Validate image size
+            (tiled.format > 0));            // Validate image format
+}
+
+// Unload tiled image source
+void UnloadTiledImage(TiledImage tiled)
+{
+    if (tiled.ctxData == NULL) return;
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (tiled.ctxType == TILED_IMAGE_PNG_STREAM) rl_png_stream_close((rl_png_stream *)tiled.ctxData);
+#endif
+    if (tiled.ctxType == TILED_IMAGE_FULL)
+    {
+        UnloadImage(*((Image *)tiled.ctxData));
+        RL_FREE(tiled.ctxData);
+    }
+}
+
+// Load image region from tiled image source, downscaled by an integer factor (box filter)
+// NOTE: Only region rows are decoded (from nearest checkpoint), region data is the only pixel data allocated
+Image LoadImageFromTiled(TiledImage tiled, Rectangle rec, int scale)
+{
+    Image image = { 0 };
+
+    if (!IsTiledImageReady(tiled)) return image;
+    if (scale < 1) scale = 1;
+
+    // Clamp region to image bounds
+    int x0 = (int)rec.x, y0 = (int)rec.y;
+    int x1 = (int)(rec.x + rec.width), y1 = (int)(rec.y + rec.height);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > tiled.width) x1 = tiled.width;
+    if (y1 > tiled.height) y1 = tiled.height;
+
+    if ((x1 <= x0) || (y1 <= y0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Tiled image region out of bounds");
+        return image;
+    }
+
+    int width = (x1 - x0 + scale - 1)/scale;
+    int height = (y1 - y0 + scale - 1)/scale;
+
+    if (tiled.ctxType == TILED_IMAGE_FULL)
+    {
+        image = ImageFromImage(*((Image *)tiled.ctxData), (Rectangle){ (float)x0, (float)y0, (float)(x1 - x0), (float)(y1 - y0) });
+        if (scale > 1) ImageResize(&image, width, height);
+    }
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    else if (tiled.ctxType == TILED_IMAGE_PNG_STREAM)
+    {
+        rl_png_stream *png = (rl_png_stream *)tiled.ctxData;
+        int channels = GetPixelDataSize(1, 1, tiled.format);
+
+        if (!rl_png_stream_seek_row(png, y0))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to seek tiled image row %i", y0);
+            return image;
+        }
+
+        unsigned char *row = (unsigned char *)LoadImageScratch(tiled.width*channels);
+        unsigned char *pixels = (unsigned char *)RL_MALLOC((size_t)width*height*channels);
+        unsigned int *sums = (scale > 1)? (unsigned int *)LoadImageScratch(width*channels*sizeof(unsigned int)) : NULL;
+        if (sums != NULL) memset(sums, 0, (size_t)width*channels*sizeof(unsigned int));
+        bool success = true;
+
+        for (int y = y0; y < y1; y++)
+        {
+            if (rl_png_stream_read_row(png, row) < 0)
+            {
+                success = false;
+                break;
+            }
+
+            int outY = (y - y0)/scale;
+
+            if (scale == 1) memcpy(pixels + (size_t)outY*width*channels, row + (size_t)x0*channels, (size_t)width*channels);
+            else
+            {
+                // Accumulate source row into output row sums
+                for (int x = x0; x < x1; x++)
+                {
+                    unsigned int *sum = sums + ((x - x0)/scale)*channels;
+                    for (int c = 0; c < channels; c++) sum[c] += row[x*channels + c];
+                }
+
+                // Output row completed (or last region row), compute averages
+                if ((((y - y0 + 1)%scale) == 0) || (y == (y1 - 1)))
+                {
+                    int rows = y - y0 - outY*scale + 1;
+
+                    for (int i = 0; i < width; i++)
+                    {
+                        int cols = ((i + 1)*scale > (x1 - x0))? (x1 - x0) - i*scale : scale;
+                        unsigned int count = (unsigned int)(rows*cols);
+
+                        for (int c = 0; c < channels; c++) pixels[((size_t)outY*width + i)*channels + c] = (unsigned char)((sums[i*channels + c] + count/2)/count);
+                    }
+
+                    memset(sums, 0, (size_t)width*channels*sizeof(unsigned int));
+                }
+            }
+        }
+
+        UnloadImageScratch(sums);
+        UnloadImageScratch(row);
+
+        if (success)
+        {
+            image.data = pixels;
+            image.width = width;
+            image.height = height;
+            image.format = tiled.format;
+            image.mipmaps = 1;
+        }
+        else
+        {
+            RL_FREE(pixels);
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to decode tiled image region");
+        }
+    }
+#endif
+
+    return image;
+}
+
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+// Set import cache directory and processing used by LoadTexture()
+// NOTE: Directory must exist, cached files are named: <content-hash>_<format>_<flags>.ktx,
+// source files are mapped to content hash by <path-size-modtime-hash>.ref files (no source read on hit)
+void SetTextureImportCache(const char *dirPath, int format, unsigned int flags)
+{
+    memset(textureImportCachePath, 0, MAX_FILEPATH_LENGTH);
+    textureImportFormat = format;
+    textureImportFlags = flags;
+
+    if (dirPath != NULL)
+    {
+        if (DirectoryExists(dirPath))
+        {
+            strncpy(textureImportCachePath, dirPath, MAX_FILEPATH_LENGTH - 1);
+            TRACELOG(LOG_INFO, "TEXTURE: Import cache set: [%s] (format: %i, flags: 0x%x)", dirPath, format, flags);
+        }
+        else TRACELOG(LOG_WARNING, "TEXTURE: [%s] Import cache directory does not exist", dirPath);
+    }
+}
+
+// Load image processed (format, TextureImportFlags), through import cache if set
+// NOTE: On cache miss, source image is decoded, processed and saved to cache
+Image LoadImageImported(const char *fileName, int format, unsigned int flags)
+{
+    Image image = { 0 };
+
+    ImportImageFile(fileName, format, flags, &image);
+
+    return image;
+}
+
+// Import directory images into import cache (multithreaded), returns imported files count
+// NOTE: Files already in cache (same content and processing) are skipped but counted as imported
+int ImportImageDirectory(const char *dirPath, const char *filter, int format, unsigned int flags)
+{
+    int count = 0;
+
+    if (textureImportCachePath[0] == '\0') TRACELOG(LOG_WARNING, "TEXTURE: Import cache directory not set, use SetTextureImportCache()");
+    else
+    {
+        FilePathList files = LoadDirectoryFilesEx(dirPath, filter, true);
+
+        if (files.count > 0)
+        {
+            ImportImageJobData data = { 0 };
+            data.files = files;
+            data.format = format;
+            data.flags = flags;
+            data.results = (bool *)RL_CALLOC(files.count, sizeof(bool));
+
+            // NOTE: Every file is decoded and processed independently, one file is the minimum job
+            RunWorkerJobs(ImportImageJob, &data, files.count, 1);
+
+            for (unsigned int i = 0; i < files.count; i++) if (data.results[i]) count++;
+
+            RL_FREE(data.results);
+        }
+
+        TRACELOG(LOG_INFO, "TEXTURE: [%s] Imported %i/%i images", dirPath, count, files.count);
+
+        UnloadDirectoryFiles(files);
+    }
+
+    return count;
+}
+#endif
+
 // Load image from GPU texture data
 // NOTE: Compressed texture formats not supported
 Image LoadImageFromTexture(Texture2D texture)
@@ -503,6 +1045,50 @@ Image LoadImageFromScreen(void)
     return image;
 }
 
+// Load multiple images from files (multithreaded), images are returned in input order
+// NOTE: Every file is read and decoded by one thread, next file is started once it is done,
+// so at most maxInFlight files data and decoders memory are allocated at once;
+// failed images are returned empty, images array must be unloaded with UnloadImages()
+Image *LoadImages(const char **fileNames, int count, int maxInFlight)
+{
+    if ((fileNames == NULL) || (count <= 0)) return NULL;
+
+    LoadImagesJobData job = { 0 };
+    job.fileNames = fileNames;
+    job.images = (Image *)RL_CALLOC(count, sizeof(Image));
+
+    RunWorkerItems(LoadImagesJob, &job, count, maxInFlight);
+
+    int loaded = 0;
+    for (int i = 0; i < count; i++) if (job.images[i].data != NULL) loaded++;
+
+    TRACELOG(LOG_INFO, "IMAGE: Loaded %i/%i images", loaded, count);
+
+    return job.images;
+}
+
+// Load multiple images from memory buffers (multithreaded), images are returned in input order
+// NOTE: fileTypes refers to extensions: i.e. '.png', at most maxInFlight images are decoded at once
+Image *LoadImagesFromMemory(const char **fileTypes, const unsigned char **fileData, const int *dataSizes, int count, int maxInFlight)
+{
+    if ((fileTypes == NULL) || (fileData == NULL) || (dataSizes == NULL) || (count <= 0)) return NULL;
+
+    LoadImagesJobData job = { 0 };
+    job.fileTypes = fileTypes;
+    job.fileData = fileData;
+    job.dataSizes = dataSizes;
+    job.images = (Image *)RL_CALLOC(count, sizeof(Image));
+
+    RunWorkerItems(LoadImagesJob, &job, count, maxInFlight);
+
+    int loaded = 0;
+    for (int i = 0; i < count; i++) if (job.images[i].data != NULL) loaded++;
+
+    TRACELOG(LOG_INFO, "IMAGE: Loaded %i/%i images from memory", loaded, count);
+
+    return job.images;
+}
+
 // Check if an image is ready
 bool IsImageReady(Image image)
 {
@@ -519,34 +1105,268 @@ void UnloadImage(Image image)
     RL_FREE(image.data);
 }
 
-// Export image data to file
-// NOTE: File format depends on fileName extension
-bool ExportImage(Image image, const char *fileName)
+// Unload images loaded with LoadImages() or LoadImagesFromMemory()
+void UnloadImages(Image *images, int count)
 {
-    int success = 0;
+    if (images == NULL) return;
 
-#if defined(SUPPORT_IMAGE_EXPORT)
-    int channels = 4;
-    bool allocatedData = false;
-    unsigned char *imgData = (unsigned char *)image.data;
+    for (int i = 0; i < count; i++) UnloadImage(images[i]);
 
-    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    RL_FREE(images);
+}
+
+// Set image scratch arena size for transient buffers, 0 to disable
+// NOTE: Arena can only be changed while no transient buffer is in use, i.e. not during image processing
+bool SetImageScratchArena(int size)
+{
+    bool result = false;
+
+    LockWorkerData();
+
+    if (imageScratchLast == -1)
     {
-        // NOTE: Getting Color array as RGBA unsigned char values
-        imgData = (unsigned char *)LoadImageColors(image);
-        allocatedData = true;
+        RL_FREE(imageScratch);
+        imageScratch = NULL;
+        imageScratchStats.capacity = 0;
+
+        if (size > 0)
+        {
+            imageScratch = (unsigned char *)RL_MALLOC(size);
+            if (imageScratch != NULL) imageScratchStats.capacity = size;
+        }
+
+        result = (imageScratchStats.capacity == size) || (size <= 0);
     }
 
-#if defined(SUPPORT_FILEFORMAT_PNG)
-    if (IsFileExtension(fileName, ".png"))
+    UnlockWorkerData();
+
+    if (!result) TRACELOG(LOG_WARNING, "IMAGE: Failed to set scratch arena (%i bytes)", size);
+    else if (size > 0) TRACELOG(LOG_INFO, "IMAGE: Scratch arena set successfully (%i bytes)", size);
+
+    return result;
+}
+
+// Get image transient memory stats (scratch arena and heap)
+ImageScratchStats GetImageScratchStats(void)
+{
+    LockWorkerData();
+    ImageScratchStats stats = imageScratchStats;
+    UnlockWorkerData();
+
+    return stats;
+}
+
+// Reset image transient memory peaks and counters
+void ResetImageScratchStats(void)
+{
+    LockWorkerData();
+
+    imageScratchStats.arenaPeak = imageScratchStats.arenaUsed;
+    imageScratchStats.transientPeak = imageScratchStats.transientUsed;
+    imageScratchStats.arenaAllocs = 0;
+    imageScratchStats.heapAllocs = 0;
+
+    UnlockWorkerData();
+}
+
+//------------------------------------------------------------------------------------
+// Animated image streaming functions
+//------------------------------------------------------------------------------------
+// Load animated image stream from file
+AnimImage LoadAnimImage(const char *fileName)
+{
+    AnimImage anim = { 0 };
+
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
     {
-        int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
-        success = SaveFileData(fileName, fileData, dataSize);
+        anim = LoadAnimImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        RL_FREE(fileData);
+    }
+
+    return anim;
+}
+
+// Load animated image stream from memory buffer, fileType refers to extension: i.e. ".gif"
+// NOTE: File data is copied internally, it is required to decode next frames
+AnimImage LoadAnimImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    AnimImage anim = { 0 };
+
+    if ((fileData == NULL) || (dataSize <= 0)) return anim;
+
+    AnimImageContext *ctx = (AnimImageContext *)RL_CALLOC(1, sizeof(AnimImageContext));
+    anim.ctxData = ctx;
+    anim.looping = true;
+    anim.ctxType = ANIM_IMAGE_STATIC;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    else if (strcmp(fileType, ".gif") == 0)
+    {
+        anim.ctxType = ANIM_IMAGE_GIF;
+        anim.frameCount = GetGifFrameCount(fileData, dataSize);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    else if (strcmp(fileType, ".png") == 0) anim.ctxType = ANIM_IMAGE_APNG;
+#endif
+
+    if (anim.ctxType != ANIM_IMAGE_STATIC)
+    {
+        ctx->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(ctx->fileData, fileData, dataSize);
+        ctx->dataSize = dataSize;
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        // PNG files without animation chunks are loaded as a single frame image
+        if ((anim.ctxType == ANIM_IMAGE_APNG) && !InitAnimPng(&anim))
+        {
+            RL_FREE(ctx->fileData);
+            ctx->fileData = NULL;
+            anim.ctxType = ANIM_IMAGE_STATIC;
+        }
+#endif
+    }
+
+    if (anim.ctxType == ANIM_IMAGE_STATIC)
+    {
+        anim.image = LoadImageFromMemory(fileType, fileData, dataSize);
+        ImageFormat(&anim.image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        anim.frameCount = (anim.image.data != NULL)? 1 : 0;
+    }
+    else
+    {
+        ResetAnimImage(&anim);
+        if (!DecodeAnimImageFrame(&anim)) anim.frameCount = 0;
+    }
+
+    if (anim.frameCount > 0) TRACELOG(LOG_INFO, "IMAGE: Animation stream loaded successfully (%ix%i | %i frames)", anim.image.width, anim.image.height, anim.frameCount);
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load animation stream");
+        UnloadAnimImage(anim);
+        anim = (AnimImage){ 0 };
+    }
+
+    return anim;
+}
+
+// Check if an animated image stream is ready
+bool IsAnimImageReady(AnimImage anim)
+{
+    return ((anim.ctxData != NULL) &&       // Validate context loaded
+            (anim.frameCount > 0) &&        // Validate frames available
+            IsImageReady(anim.image));      // Validate current frame image
+}
+
+// Unload animated image stream
+void UnloadAnimImage(AnimImage anim)
+{
+    AnimImageContext *ctx = (AnimImageContext *)anim.ctxData;
+
+    if (ctx != NULL)
+    {
+#if defined(SUPPORT_FILEFORMAT_GIF)
+        if (anim.ctxType == ANIM_IMAGE_GIF)
+        {
+            // NOTE: anim.image.data points to decoder output buffer (gif.out)
+            RL_FREE(ctx->gif.out);
+            RL_FREE(ctx->gif.background);
+            RL_FREE(ctx->gif.history);
+            RL_FREE(ctx->gifPrevious);
+            RL_FREE(ctx->gifScratch);
+        }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        if (anim.ctxType == ANIM_IMAGE_APNG)
+        {
+            // NOTE: anim.image.data points to canvas
+            RL_FREE(ctx->pngFrameOffsets);
+            RL_FREE(ctx->canvas);
+            RL_FREE(ctx->backup);
+        }
+#endif
+        if (anim.ctxType == ANIM_IMAGE_STATIC) UnloadImage(anim.image);
+
+        RL_FREE(ctx->fileData);
+        RL_FREE(ctx);
+    }
+}
+
+// Decode next frame into anim.image, returns false if last frame reached (not looping)
+bool UpdateAnimImage(AnimImage *anim)
+{
+    if ((anim == NULL) || (anim->ctxData == NULL) || (anim->frameCount <= 0)) return false;
+
+    if (anim->currentFrame >= (anim->frameCount - 1))
+    {
+        if (!anim->looping) return false;
+
+        // Static images do not change, no need to decode again
+        if (anim->ctxType == ANIM_IMAGE_STATIC) return true;
+
+        ResetAnimImage(anim);
+    }
+
+    return DecodeAnimImageFrame(anim);
+}
+
+// Seek animated image stream to a frame
+// NOTE: Animated frames depend on previous ones, seeking backwards decodes again from first frame
+void SeekAnimImage(AnimImage *anim, int frame)
+{
+    if ((anim == NULL) || (anim->ctxData == NULL) || (anim->frameCount <= 0) || (anim->ctxType == ANIM_IMAGE_STATIC)) return;
+
+    if (frame < 0) frame = 0;
+    if (frame >= anim->frameCount) frame = anim->frameCount - 1;
+
+    if (frame < anim->currentFrame)
+    {
+        ResetAnimImage(anim);
+        if (!DecodeAnimImageFrame(anim)) return;
+    }
+
+    while (anim->currentFrame < frame)
+    {
+        if (!DecodeAnimImageFrame(anim)) break;
+    }
+}
+
+// Export image data to file
+// NOTE: File format depends on fileName extension
+bool ExportImage(Image image, const char *fileName)
+{
+    int success = 0;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
+    {
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageScratchColors(image);
+        allocatedData = true;
+    }
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png"))
+    {
+        int dataSize = 0;
+    #if defined(SUPPORT_COMPRESSION_API)
+        unsigned char *fileData = EncodeImagePng(imgData, image.width, image.height, channels, pngCompressionLevel, &dataSize);
+    #else
+        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+    #endif
+        if (fileData != NULL) success = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
 #else
@@ -595,7 +1415,7 @@ bool ExportImage(Image image, const char *fileName)
         success = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
     }
 
-    if (allocatedData) RL_FREE(imgData);
+    if (allocatedData) UnloadImageScratch(imgData);
 #endif      // SUPPORT_IMAGE_EXPORT
 
     if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
@@ -604,6 +1424,69 @@ bool ExportImage(Image image, const char *fileName)
     return success;
 }
 
+// Export image to memory buffer
+// NOTE: Supported file types: .png, .qoi (lowercase, compared without IsFileExtension(), safe to be used from other threads)
+// Memory buffer should be freed with MemFree()
+unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize)
+{
+    unsigned char *fileData = NULL;
+    *fileSize = 0;
+
+    // Security check for input data
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return NULL;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
+    {
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageScratchColors(image);
+        allocatedData = true;
+    }
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (strcmp(fileType, ".png") == 0)
+    {
+    #if defined(SUPPORT_COMPRESSION_API)
+        fileData = EncodeImagePng(imgData, image.width, image.height, channels, pngCompressionLevel, fileSize);
+    #else
+        fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, fileSize);
+    #endif
+    }
+#else
+    if (false) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    else if (strcmp(fileType, ".qoi") == 0)
+    {
+        if ((channels == 3) || (channels == 4))
+        {
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
+
+            fileData = (unsigned char *)qoi_encode(imgData, &desc, fileSize);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Pixel format must be R8G8B8 or R8G8B8A8");
+    }
+#endif
+    else TRACELOG(LOG_WARNING, "IMAGE: Export file type not supported: %s", fileType);
+
+    if (allocatedData) UnloadImageScratch(imgData);
+#endif      // SUPPORT_IMAGE_EXPORT
+
+    return fileData;
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool ExportImageAsCode(Image image, const char *fileName)
 {
@@ -661,6 +1544,18 @@ bool ExportImageAsCode(Image image, const char *fileName)
     return success;
 }
 
+// Set PNG export compression level (PngCompressionLevel)
+// NOTE: PNG_COMPRESSION_FAST is intended for screenshots and tooling, favoring speed over size
+void SetPngCompressionLevel(int level)
+{
+#if defined(SUPPORT_IMAGE_EXPORT)
+    pngCompressionLevel = (level < PNG_COMPRESSION_FAST)? PNG_COMPRESSION_FAST : ((level > PNG_COMPRESSION_BEST)? PNG_COMPRESSION_BEST : level);
+
+    // NOTE: stb_image_write compression levels are also used if sdefl compressor is not available
+    stbi_write_png_compression_level = (pngCompressionLevel == PNG_COMPRESSION_FAST)? 1 : pngCompressionLevel;
+#endif
+}
+
 //------------------------------------------------------------------------------------
 // Image generation functions
 //------------------------------------------------------------------------------------
@@ -686,22 +1581,17 @@ Image GenImageColor(int width, int height, Color color)
 // Generate image: vertical gradient
 Image GenImageGradientV(int width, int height, Color top, Color bottom)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.col1 = top;
+    job.col2 = bottom;
 
-    for (int j = 0; j < height; j++)
-    {
-        float factor = (float)j/(float)height;
-        for (int i = 0; i < width; i++)
-        {
-            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
-        }
-    }
+    RunWorkerJobs(GenImageGradientVJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -714,22 +1604,17 @@ Image GenImageGradientV(int width, int height, Color top, Color bottom)
 // Generate image: horizontal gradient
 Image GenImageGradientH(int width, int height, Color left, Color right)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.col1 = left;
+    job.col2 = right;
 
-    for (int i = 0; i < width; i++)
-    {
-        float factor = (float)i/(float)width;
-        for (int j = 0; j < height; j++)
-        {
-            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
-        }
-    }
+    RunWorkerJobs(GenImageGradientHJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -742,31 +1627,18 @@ Image GenImageGradientH(int width, int height, Color left, Color right)
 // Generate image: radial gradient
 Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.col1 = inner;
+    job.col2 = outer;
+    job.factor = density;
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
-
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
-
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    RunWorkerJobs(GenImageGradientRadialJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -779,19 +1651,19 @@ Image GenImageGradientRadial(int width, int height, float density, Color inner,
 // Generate image: checked
 Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.col1 = col1;
+    job.col2 = col2;
+    job.tileSizeX = checksX;
+    job.tileSizeY = checksY;
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
-        }
-    }
+    RunWorkerJobs(GenImageCheckedJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -802,18 +1674,21 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 }
 
 // Generate image: white noise
+// NOTE: Random generator seed (SetRandomSeed()) is used to generate a per-pixel hash,
+// result does not depend on the number of threads used for generation
 Image GenImageWhiteNoise(int width, int height, float factor)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.factor = factor;
+    job.seed = (unsigned int)GetRandomValue(0, 0x7fff) | ((unsigned int)GetRandomValue(0, 0x7fff) << 15);
 
-    for (int i = 0; i < width*height; i++)
-    {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
-    }
+    RunWorkerJobs(GenImageWhiteNoiseJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -826,30 +1701,56 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 // Generate image: perlin noise
 Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*scale/(float)width;
-            float ny = (float)(y + offsetY)*scale/(float)height;
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.offsetX = offsetX;
+    job.offsetY = offsetY;
+    job.scale = scale;
+
+    // Typical values to start playing with:
+    //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+    //   gain       =  0.5   -- relative weighting applied to each successive octave
+    //   octaves    =  6     -- number of "octaves" of noise3() to sum
+    job.lacunarity = 2.0f;
+    job.gain = 0.5f;
+    job.octaves = 6;
+
+    RunWorkerJobs(GenImagePerlinNoiseJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+    Image image = {
+        .data = job.pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-            // NOTE: We need to translate the data from [-1..1] to [0..1]
-            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
+    return image;
+}
 
-            int intensity = (int)(p*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+// Generate image: fractal noise (perlin noise octaves), seeded
+// NOTE: Output only depends on provided parameters, same seed always generates the same image,
+// lower 16 bits of seed are used to select the noise variation
+Image GenImageFractalNoise(int width, int height, int offsetX, int offsetY, float scale, int octaves, float lacunarity, float gain, int seed)
+{
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.offsetX = offsetX;
+    job.offsetY = offsetY;
+    job.scale = scale;
+    job.octaves = (octaves < 1)? 1 : octaves;
+    job.lacunarity = lacunarity;
+    job.gain = gain;
+    job.seed = (unsigned int)seed;
+
+    RunWorkerJobs(GenImageFractalNoiseJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -862,12 +1763,18 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 // Generate image: cellular algorithm. Bigger tileSize means bigger cells
 Image GenImageCellular(int width, int height, int tileSize)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImageJobData job = { 0 };
+    job.pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job.width = width;
+    job.height = height;
+    job.tileSizeX = tileSize;
+    job.tileSizeY = tileSize;
 
     int seedsPerRow = width/tileSize;
     int seedsPerCol = height/tileSize;
     int seedCount = seedsPerRow*seedsPerCol;
 
+    // NOTE: Seeds are generated before processing, so result does not depend on the number of threads
     Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
 
     for (int i = 0; i < seedCount; i++)
@@ -877,44 +1784,16 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+    job.seeds = seeds;
+    job.seedsPerRow = seedsPerRow;
+    job.seedsPerCol = seedsPerCol;
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    RunWorkerJobs(GenImageCellularJob, &job, height, GEN_IMAGE_JOB_ROWS(width));
 
     RL_FREE(seeds);
 
     Image image = {
-        .data = pixels,
+        .data = job.pixels,
         .width = width,
         .height = height,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
@@ -987,22 +1866,7 @@ Image ImageCopy(Image image)
 // Create an image from another image piece
 Image ImageFromImage(Image image, Rectangle rec)
 {
-    Image result = { 0 };
-
-    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
-
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
-
-    for (int y = 0; y < (int)rec.height; y++)
-    {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
-    }
-
-    return result;
+    return ImageFromView(GetImageView(image, rec));
 }
 
 // Crop an image to area defined by a rectangle
@@ -1017,7 +1881,7 @@ void ImageCrop(Image *image, Rectangle crop)
     if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
     if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
     if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
-    if ((crop.x > image->width) || (crop.y > image->height))
+    if ((crop.x > image->width) || (crop.y > image->height) || (crop.width < 1) || (crop.height < 1))
     {
         TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
         return;
@@ -1028,32 +1892,24 @@ void ImageCrop(Image *image, Rectangle crop)
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        int rowSize = (int)crop.width*bytesPerPixel;
+        unsigned char *data = (unsigned char *)image->data;
 
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
-
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
+        // Move cropped data line-by-line, in place (no new allocation required)
+        // NOTE: Rows are always moved backwards, overlapping rows are handled by memmove()
+        for (int y = 0; y < (int)crop.height; y++)
         {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
+            memmove(data + y*rowSize, data + ((y + (int)crop.y)*image->width + (int)crop.x)*bytesPerPixel, rowSize);
         }
 
-        /*
-        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
-        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
-        {
-            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
-            {
-                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-        */
+        // Shrink data buffer to cropped size (usually done in place)
+        // NOTE: Cropped size is never zero, on reallocation failure previous buffer is still valid
+        unsigned char *croppedData = (unsigned char *)RL_REALLOC(data, rowSize*(int)crop.height);
+        if (croppedData != NULL) image->data = croppedData;
 
-        RL_FREE(image->data);
-        image->data = croppedData;
         image->width = (int)crop.width;
         image->height = (int)crop.height;
+        image->mipmaps = 1;
     }
 }
 
@@ -1216,7 +2072,7 @@ void ImageFormat(Image *image, int newFormat)
                 default: break;
             }
 
-            RL_FREE(pixels);
+            UnloadImageScratch(pixels);
             pixels = NULL;
 
             // In case original image had mipmaps, generate mipmaps for formatted image
@@ -1258,6 +2114,7 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 
     int textOffsetX = 0;            // Image drawing position X
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    int prevCodepoint = -1;         // Previous codepoint in line, for kerning
 
     // NOTE: Text image is generated at font base size, later scaled to desired font size
     Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
@@ -1279,13 +2136,16 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 
         if (codepoint == '\n')
         {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (font.baseSize + font.baseSize/2);
+            // NOTE: Line spacing is a line height factor, set with SetTextLineSpacingFactor()
+            textOffsetY += (int)(font.baseSize*GetTextLineSpacingFactor());   // WARNING: Module required: rtext
             textOffsetX = 0;
+            prevCodepoint = -1;
         }
         else
         {
+            if (prevCodepoint >= 0) textOffsetX += (int)roundf(GetGlyphKerning(font, prevCodepoint, codepoint));  // WARNING: Module required: rtext
+            prevCodepoint = codepoint;
+
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
                 Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
@@ -1324,7 +2184,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageScratchColors(*image);
     Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
     // EDIT: added +1 to account for an early rounding problem
@@ -1345,6 +2205,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 
     int format = image->format;
 
+    UnloadImageScratch(pixels);
     RL_FREE(image->data);
 
     image->data = output;
@@ -1353,8 +2214,6 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
 }
 
 
@@ -1394,7 +2253,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     else
     {
         // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
+        Color *pixels = LoadImageScratchColors(*image);
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
@@ -1402,7 +2261,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         int format = image->format;
 
-        UnloadImageColors(pixels);
+        UnloadImageScratch(pixels);
         RL_FREE(image->data);
 
         image->data = output;
@@ -1497,6 +2356,19 @@ void ImageAlphaCrop(Image *image, float threshold)
     if (((int)crop.width != 0) && ((int)crop.height != 0)) ImageCrop(image, crop);
 }
 
+// Crop multiple images depending on alpha value
+// NOTE: Images are cropped in parallel, i.e. sprites trimming
+void ImageAlphaCropBatch(Image *images, int count, float threshold)
+{
+    if ((images == NULL) || (count <= 0)) return;
+
+    AlphaBorderJobData job = { 0 };
+    job.images = images;
+    job.threshold = threshold;
+
+    RunWorkerJobs(ImageAlphaCropBatchJob, &job, count, 16);
+}
+
 // Clear alpha channel to desired color
 // NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
 void ImageAlphaClear(Image *image, Color color, float threshold)
@@ -1603,9 +2475,13 @@ void ImageAlphaMask(Image *image, Image alphaMask)
     }
     else
     {
-        // Force mask to be Grayscale
-        Image mask = ImageCopy(alphaMask);
-        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        // Force mask to be Grayscale, mask is only copied if it requires conversion
+        Image mask = alphaMask;
+        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+        {
+            mask = ImageCopy(alphaMask);
+            ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        }
 
         // In case image is only grayscale, we just add alpha channel
         if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
@@ -1635,7 +2511,7 @@ void ImageAlphaMask(Image *image, Image alphaMask)
             }
         }
 
-        UnloadImage(mask);
+        if (mask.data != alphaMask.data) UnloadImage(mask);
     }
 }
 
@@ -1684,8 +2560,8 @@ void ImageBlurGaussian(Image *image, int blurSize) {
     Color *pixels = LoadImageColors(*image);
 
     // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *pixelsCopy1 = (Vector4 *)LoadImageScratch((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = (Vector4 *)LoadImageScratch((image->height)*(image->width)*sizeof(Vector4));
 
     for (int i = 0; i < (image->height)*(image->width); i++) {
         pixelsCopy1[i].x = pixels[i].r;
@@ -1817,8 +2693,8 @@ void ImageBlurGaussian(Image *image, int blurSize) {
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    UnloadImageScratch(pixelsCopy2);
+    UnloadImageScratch(pixelsCopy1);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -1904,213 +2780,121 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
         return;
     }
 
-    if ((rBpp + gBpp + bBpp + aBpp) > 16)
+    // Define new image format, check if desired bpp match internal known format
+    int format = 0;
+    if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+    else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+    else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+    else
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
+        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+        return;
     }
-    else
+
+    if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
     {
-        Color *pixels = LoadImageColors(*image);
+        TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
+    }
 
-        RL_FREE(image->data);      // free old image data
+    ImageDitherEx(image, format, DITHER_FLOYD_STEINBERG);
+}
 
-        if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
-        {
-            TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
-        }
-
-        // Define new image format, check if desired bpp match internal known format
-        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
-        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
-        else
-        {
-            image->format = 0;
-            TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
-        }
-
-        // NOTE: We will store the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
+// Dither image data to pixel format, using DitherMethod
+// NOTE: Only R5G6B5, R5G5B5A1 and R4G4B4A4 formats lose channels precision, other formats are
+// just converted; R5G5B5A1 alpha is not dithered, it uses the same threshold as ImageFormat()
+void ImageDitherEx(Image *image, int newFormat, int method)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+    if ((image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (newFormat >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        return;
+    }
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+    DitherJobData job = { 0 };
 
-        for (int y = 0; y < image->height; y++)
+    switch (newFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5: job.bits[0] = 5; job.bits[1] = 6; job.bits[2] = 5; job.bits[3] = 0; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: job.bits[0] = 5; job.bits[1] = 5; job.bits[2] = 5; job.bits[3] = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: job.bits[0] = 4; job.bits[1] = 4; job.bits[2] = 4; job.bits[3] = 4; break;
+        default:
         {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
-
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+            // No channel precision is lost, there is nothing to dither
+            ImageFormat(image, newFormat);
+            return;
+        }
+    }
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+    job.data = (const unsigned char *)image->data;
+    job.format = image->format;
+    job.width = image->width;
+    job.height = image->height;
+    job.method = method;
+    job.pixels = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+    if (method == DITHER_FLOYD_STEINBERG) DitherErrorDiffusion(&job);
+    else
+    {
+        // NOTE: Mask is generated before running jobs, it is shared by all of them,
+        // generation is locked in case images are dithered from multiple threads
+        if (method == DITHER_ORDERED_BLUE_NOISE)
+        {
+            LockWorkerData();
+            if (!ditherBlueNoiseReady) GenDitherBlueNoise();
+            UnlockWorkerData();
+        }
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+        RunWorkerJobs(DitherOrderedJob, &job, image->height, GEN_IMAGE_JOB_ROWS(image->width));
+    }
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+    int mipmaps = image->mipmaps;
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+    RL_FREE(image->data);
+    image->data = job.pixels;
+    image->format = newFormat;
+    image->mipmaps = 1;
 
-        UnloadImageColors(pixels);
-    }
+    // In case original image had mipmaps, generate mipmaps for dithered image
+    if (mipmaps > 1) ImageMipmaps(image);
 }
 
 // Flip image vertically
 void ImageFlipVertical(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-    }
+    ImageTransform(image, IMAGE_TRANSFORM_FLIP_VERTICAL);
 }
 
 // Flip image horizontally
 void ImageFlipHorizontal(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcopy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
-    }
+    ImageTransform(image, IMAGE_TRANSFORM_FLIP_HORIZONTAL);
 }
 
 // Rotate image clockwise 90deg
 void ImageRotateCW(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
-    }
+    ImageTransform(image, IMAGE_TRANSFORM_ROTATE_CW);
 }
 
 // Rotate image counter-clockwise 90deg
 void ImageRotateCCW(Image *image)
+{
+    ImageTransform(image, IMAGE_TRANSFORM_ROTATE_CCW);
+}
+
+// Apply orientation transform to image (ImageTransformType)
+// NOTE: Flips and 180deg rotation are done in place, 90deg rotations and transpositions are
+// done in place for square images, other images are transformed in one pass into a new buffer
+void ImageTransform(Image *image, int transform)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2120,24 +2904,76 @@ void ImageRotateCCW(Image *image)
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        int width = image->width;
+        int height = image->height;
+        unsigned char *data = (unsigned char *)image->data;
 
-        for (int y = 0; y < image->height; y++)
+        switch (transform)
         {
-            for (int x = 0; x < image->width; x++)
+            case IMAGE_TRANSFORM_NONE: break;
+            case IMAGE_TRANSFORM_FLIP_HORIZONTAL:
             {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+                for (int y = 0; y < height; y++) ReverseImagePixels(data + y*width*bytesPerPixel, width, bytesPerPixel);
+            } break;
+            case IMAGE_TRANSFORM_FLIP_VERTICAL:
+            {
+                // Swap rows by chunks, no additional allocations required
+                unsigned char temp[1024] = { 0 };
+                int rowSize = width*bytesPerPixel;
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+                for (int y = 0; y < height/2; y++)
+                {
+                    unsigned char *top = data + y*rowSize;
+                    unsigned char *bottom = data + (height - 1 - y)*rowSize;
+
+                    for (int offset = 0; offset < rowSize; offset += (int)sizeof(temp))
+                    {
+                        int size = ((rowSize - offset) < (int)sizeof(temp))? (rowSize - offset) : (int)sizeof(temp);
+
+                        memcpy(temp, top + offset, size);
+                        memcpy(top + offset, bottom + offset, size);
+                        memcpy(bottom + offset, temp, size);
+                    }
+                }
+            } break;
+            case IMAGE_TRANSFORM_ROTATE_180: ReverseImagePixels(data, width*height, bytesPerPixel); break;
+            case IMAGE_TRANSFORM_ROTATE_CW:
+            case IMAGE_TRANSFORM_ROTATE_CCW:
+            case IMAGE_TRANSFORM_TRANSPOSE:
+            case IMAGE_TRANSFORM_TRANSVERSE:
+            {
+                if (width == height)
+                {
+                    // Square images: transpose in place, then flip in place as required
+                    TransposeImagePixels(data, width, bytesPerPixel);
+
+                    if (transform == IMAGE_TRANSFORM_ROTATE_CW) ImageTransform(image, IMAGE_TRANSFORM_FLIP_HORIZONTAL);
+                    else if (transform == IMAGE_TRANSFORM_ROTATE_CCW) ImageTransform(image, IMAGE_TRANSFORM_FLIP_VERTICAL);
+                    else if (transform == IMAGE_TRANSFORM_TRANSVERSE) ImageTransform(image, IMAGE_TRANSFORM_ROTATE_180);
+                }
+                else
+                {
+                    unsigned char *transformedData = (unsigned char *)RL_MALLOC(width*height*bytesPerPixel);
 
-        image->width = height;
-        image->height = width;
+                    if (transformedData != NULL)
+                    {
+                        // Destination image is (height x width), source pixel (x, y) destination index: origin + x*stepX + y*stepY
+                        int origin = 0, stepX = height, stepY = 1;                                               // Transpose: (y, x)
+                        if (transform == IMAGE_TRANSFORM_ROTATE_CW) { origin = height - 1; stepY = -1; }        // (height - 1 - y, x)
+                        else if (transform == IMAGE_TRANSFORM_ROTATE_CCW) { origin = (width - 1)*height; stepX = -height; }     // (y, width - 1 - x)
+                        else if (transform == IMAGE_TRANSFORM_TRANSVERSE) { origin = width*height - 1; stepX = -height; stepY = -1; }  // (height - 1 - y, width - 1 - x)
+
+                        TransformImagePixels(data, transformedData, width, height, bytesPerPixel, origin, stepX, stepY);
+
+                        RL_FREE(image->data);
+                        image->data = transformedData;
+                        image->width = height;
+                        image->height = width;
+                    }
+                }
+            } break;
+            default: TRACELOG(LOG_WARNING, "IMAGE: Image transform not supported (%i)", transform); break;
+        }
     }
 }
 
@@ -2147,37 +2983,11 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y*image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
-
-            pixels[index].r = r;
-            pixels[index].g = g;
-            pixels[index].b = b;
-            pixels[index].a = a;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    unsigned char lut[4][256] = { 0 };
+    SetColorLUTIdentity(lut);
+    SetColorLUTTint(lut, color);
 
-    ImageFormat(image, format);
+    ImageApplyColorLUT(image, lut, 0);
 }
 
 // Modify image color: invert
@@ -2186,25 +2996,17 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char lut[4][256] = { 0 };
+    SetColorLUTIdentity(lut);
 
-    for (int y = 0; y < image->height; y++)
+    for (int i = 0; i < 256; i++)
     {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
+        lut[0][i] = 255 - i;
+        lut[1][i] = 255 - i;
+        lut[2][i] = 255 - i;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageApplyColorLUT(image, lut, 0);
 }
 
 // Modify image color: grayscale
@@ -2220,55 +3022,11 @@ void ImageColorContrast(Image *image, float contrast)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
-
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5f;
-            pR *= contrast;
-            pR += 0.5f;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5f;
-            pG *= contrast;
-            pG += 0.5f;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5f;
-            pB *= contrast;
-            pB += 0.5f;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    unsigned char lut[4][256] = { 0 };
+    SetColorLUTIdentity(lut);
+    SetColorLUTContrast(lut, contrast);
 
-    ImageFormat(image, format);
+    ImageApplyColorLUT(image, lut, 0);
 }
 
 // Modify image color: brightness
@@ -2278,41 +3036,34 @@ void ImageColorBrightness(Image *image, int brightness)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
+    unsigned char lut[4][256] = { 0 };
+    SetColorLUTIdentity(lut);
+    SetColorLUTBrightness(lut, brightness);
 
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
+    ImageApplyColorLUT(image, lut, 0);
+}
 
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
+// Modify image color: grayscale, tint, contrast and brightness combined in one pass
+// NOTE: Adjustments applied in that order, neutral values skip the adjustment:
+// grayscale (0.0f to 1.0f, blend to luminance), tint (WHITE), contrast (0), brightness (0)
+// For R8G8B8 and R8G8B8A8 images, result is the same as calling ImageColorTint(), ImageColorContrast()
+// and ImageColorBrightness() in a row, other formats are only converted once (less quantization)
+void ImageColorAdjust(Image *image, float grayscale, Color tint, float contrast, int brightness)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
-    }
+    if (grayscale < 0.0f) grayscale = 0.0f;
+    if (grayscale > 1.0f) grayscale = 1.0f;
 
-    int format = image->format;
-    RL_FREE(image->data);
+    unsigned char lut[4][256] = { 0 };
+    SetColorLUTIdentity(lut);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    if ((tint.r != 255) || (tint.g != 255) || (tint.b != 255) || (tint.a != 255)) SetColorLUTTint(lut, tint);
+    if (contrast != 0.0f) SetColorLUTContrast(lut, contrast);
+    if (brightness != 0) SetColorLUTBrightness(lut, brightness);
 
-    ImageFormat(image, format);
+    ImageApplyColorLUT(image, lut, (int)(grayscale*256.0f + 0.5f));
 }
 
 // Modify image color: replace color
@@ -2321,32 +3072,89 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char *data = (unsigned char *)image->data;
+    int pixelCount = image->width*image->height;
 
-    for (int y = 0; y < image->height; y++)
+    // Replace color in-place for 8-bit per channel formats,
+    // colors not representable in the image format are never found
+    switch (image->format)
     {
-        for (int x = 0; x < image->width; x++)
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            int channels = (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : 2;
+
+            if ((color.r == color.g) && (color.r == color.b) && ((channels == 2) || (color.a == 255)))
+            {
+                unsigned char gray = GetColorLUTGray(replace.r, replace.g, replace.b);
+
+                for (int i = 0; i < pixelCount*channels; i += channels)
+                {
+                    if ((data[i] == color.r) && ((channels == 1) || (data[i + 1] == color.a)))
+                    {
+                        data[i] = gray;
+                        if (channels == 2) data[i + 1] = replace.a;
+                    }
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
         {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
+            if (color.a == 255)
             {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
+                for (int i = 0; i < pixelCount*3; i += 3)
+                {
+                    if ((data[i] == color.r) && (data[i + 1] == color.g) && (data[i + 2] == color.b))
+                    {
+                        data[i] = replace.r;
+                        data[i + 1] = replace.g;
+                        data[i + 2] = replace.b;
+                    }
+                }
             }
-        }
-    }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            // NOTE: Pixels compared as 32bit values, byte order is the same in both sides
+            unsigned int colorValue = 0;
+            unsigned int replaceValue = 0;
+            memcpy(&colorValue, &color, 4);
+            memcpy(&replaceValue, &replace, 4);
 
-    int format = image->format;
-    RL_FREE(image->data);
+            for (int i = 0; i < pixelCount; i++)
+            {
+                unsigned int value = 0;
+                memcpy(&value, data + i*4, 4);
+                if (value == colorValue) memcpy(data + i*4, &replaceValue, 4);
+            }
+        } break;
+        default:
+        {
+            Color *pixels = LoadImageColors(*image);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            for (int i = 0; i < pixelCount; i++)
+            {
+                if ((pixels[i].r == color.r) &&
+                    (pixels[i].g == color.g) &&
+                    (pixels[i].b == color.b) &&
+                    (pixels[i].a == color.a))
+                {
+                    pixels[i].r = replace.r;
+                    pixels[i].g = replace.g;
+                    pixels[i].b = replace.b;
+                    pixels[i].a = replace.a;
+                }
+            }
 
-    ImageFormat(image, format);
+            int format = image->format;
+            RL_FREE(image->data);
+
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            ImageFormat(image, format);
+        } break;
+    }
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -2365,118 +3173,21 @@ Color *LoadImageColors(Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+        GetPixelDataColors(image.data, image.width*image.height, image.format, pixels);
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+    return pixels;
+}
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Load colors palette from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+{
+    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
-    }
-
-    return pixels;
-}
-
-// Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
-{
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
-    int palCount = 0;
-    Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageScratchColors(image);
 
     if (pixels != NULL)
     {
@@ -2516,7 +3227,7 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
             }
         }
 
-        UnloadImageColors(pixels);
+        UnloadImageScratch(pixels);
     }
 
     *colorCount = palCount;
@@ -2540,41 +3251,22 @@ void UnloadImagePalette(Color *colors)
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
-    Rectangle crop = { 0 };
-
-    Color *pixels = LoadImageColors(image);
-
-    if (pixels != NULL)
-    {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
-
-        for (int y = 0; y < image.height; y++)
-        {
-            for (int x = 0; x < image.width; x++)
-            {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
-        }
+    return GetImageViewAlphaBorder(GetImageView(image, (Rectangle){ 0, 0, (float)image.width, (float)image.height }), threshold);
+}
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
-        {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
-        }
+// Get alpha border rectangles of multiple image regions, i.e. sprite sheet frames
+// NOTE: Every rectangle is replaced by its alpha border in image coordinates,
+// fully transparent regions get a zero size rectangle at their origin
+void GetImageAlphaBorders(Image image, Rectangle *recs, int count, float threshold)
+{
+    if ((recs == NULL) || (count <= 0)) return;
 
-        UnloadImageColors(pixels);
-    }
+    AlphaBorderJobData job = { 0 };
+    job.image = image;
+    job.recs = recs;
+    job.threshold = threshold;
 
-    return crop;
+    RunWorkerJobs(GetImageAlphaBordersJob, &job, count, 16);
 }
 
 // Get image pixel color at (x, y) position
@@ -2680,6 +3372,169 @@ Color GetImageColor(Image image, int x, int y)
     return color;
 }
 
+//------------------------------------------------------------------------------------
+// Image view functions
+//------------------------------------------------------------------------------------
+// Get image view of a rectangle, no pixel data copied
+// NOTE: Rectangle is clamped to image bounds, only base mipmap level is referenced
+ImageView GetImageView(Image image, Rectangle rec)
+{
+    ImageView view = { 0 };
+
+    // Security check to avoid program crash
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return view;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image view not supported for compressed formats");
+        return view;
+    }
+
+    view.data = image.data;
+    view.width = image.width;
+    view.height = image.height;
+    view.stride = GetPixelDataSize(image.width, 1, image.format);
+    view.format = image.format;
+
+    return GetImageSubView(view, rec);
+}
+
+// Get image view of a rectangle within another view
+// NOTE: Rectangle is relative to view and clamped to view bounds
+ImageView GetImageSubView(ImageView view, Rectangle rec)
+{
+    ImageView subView = { 0 };
+
+    // Security check to avoid program crash
+    if ((view.data == NULL) || (view.width == 0) || (view.height == 0)) return subView;
+
+    int x = (int)rec.x;
+    int y = (int)rec.y;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
+
+    // Rectangle out-of-bounds security checks
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > view.width) width = view.width - x;
+    if ((y + height) > view.height) height = view.height - y;
+
+    if ((width > 0) && (height > 0))
+    {
+        subView.data = (unsigned char *)view.data + y*view.stride + x*GetPixelDataSize(1, 1, view.format);
+        subView.width = width;
+        subView.height = height;
+        subView.stride = view.stride;
+        subView.format = view.format;
+    }
+
+    return subView;
+}
+
+// Create an image from image view (pixel data copied)
+Image ImageFromView(ImageView view)
+{
+    Image image = { 0 };
+
+    // Security check to avoid program crash
+    if ((view.data == NULL) || (view.width == 0) || (view.height == 0)) return image;
+
+    int rowSize = GetPixelDataSize(view.width, 1, view.format);
+
+    image.data = RL_MALLOC(rowSize*view.height);
+
+    if (image.data != NULL)
+    {
+        image.width = view.width;
+        image.height = view.height;
+        image.mipmaps = 1;
+        image.format = view.format;
+
+        // Copy data in a single block if view rows are contiguous
+        if (view.stride == rowSize) memcpy(image.data, view.data, rowSize*view.height);
+        else
+        {
+            for (int y = 0; y < view.height; y++) memcpy((unsigned char *)image.data + y*rowSize, (unsigned char *)view.data + y*view.stride, rowSize);
+        }
+    }
+
+    return image;
+}
+
+// Load color data from image view as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors()
+Color *LoadImageViewColors(ImageView view)
+{
+    if ((view.data == NULL) || (view.width == 0) || (view.height == 0)) return NULL;
+
+    Color *pixels = (Color *)RL_MALLOC(view.width*view.height*sizeof(Color));
+
+    if (pixels != NULL)
+    {
+        for (int y = 0; y < view.height; y++) GetPixelDataColors((unsigned char *)view.data + y*view.stride, view.width, view.format, pixels + y*view.width);
+    }
+
+    return pixels;
+}
+
+// Get image view alpha border rectangle
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f, rows are scanned inwards from every edge
+// and every scan stops at first pixel found, so only transparent margins are fully checked
+Rectangle GetImageViewAlphaBorder(ImageView view, float threshold)
+{
+    Rectangle crop = { 0 };
+
+    // Security check to avoid program crash
+    if ((view.data == NULL) || (view.width == 0) || (view.height == 0) || (view.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return crop;
+
+    unsigned char alphaThreshold = (unsigned char)(threshold*255.0f);
+    Color *buffer = (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? NULL : (Color *)LoadImageScratch(view.width*sizeof(Color));
+    const unsigned char *data = (const unsigned char *)view.data;
+
+    // Scan rows from top and bottom edges
+    int yMin = 0;
+    while ((yMin < view.height) && (GetAlphaRowFirst(GetPixelRowColors(data + yMin*view.stride, view.width, view.format, buffer), 0, view.width, alphaThreshold) == view.width)) yMin++;
+
+    // Check for empty blank image
+    if (yMin < view.height)
+    {
+        int yMax = view.height - 1;
+        while ((yMax > yMin) && (GetAlphaRowFirst(GetPixelRowColors(data + yMax*view.stride, view.width, view.format, buffer), 0, view.width, alphaThreshold) == view.width)) yMax--;
+
+        // Scan remaining rows from left and right edges, only up to the border already found
+        int xMin = view.width;
+        int xMax = -1;
+
+        for (int y = yMin; (y <= yMax) && ((xMin > 0) || (xMax < (view.width - 1))); y++)
+        {
+            const Color *pixels = GetPixelRowColors(data + y*view.stride, view.width, view.format, buffer);
+
+            xMin = GetAlphaRowFirst(pixels, 0, xMin, alphaThreshold);
+            xMax = GetAlphaRowLast(pixels, xMax + 1, view.width, alphaThreshold);
+        }
+
+        crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+    }
+
+    UnloadImageScratch(buffer);
+
+    return crop;
+}
+
+// Get image view pixel color at (x, y) position
+Color GetImageViewColor(ImageView view, int x, int y)
+{
+    Color color = { 0 };
+
+    if ((view.data != NULL) && (x >= 0) && (x < view.width) && (y >= 0) && (y < view.height))
+    {
+        GetPixelDataColors((unsigned char *)view.data + y*view.stride + x*GetPixelDataSize(1, 1, view.format), 1, view.format, &color);
+    }
+    else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
+
+    return color;
+}
+
 //------------------------------------------------------------------------------------
 // Image drawing functions
 //------------------------------------------------------------------------------------
@@ -2689,17 +3544,17 @@ void ImageClearBackground(Image *dst, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Fill in first row, then repeat it throughout the image
+    int rowSize = dst->width*bytesPerPixel;
+    unsigned char *pSrcRow = (unsigned char *)dst->data;
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width * dst->height; i++)
-    {
-        memcpy(pSrcPixel + i * bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    ImageFillSpan(dst, 0, dst->width, 0, pixel, bytesPerPixel);
+
+    for (int y = 1; y < dst->height; y++) memcpy(pSrcRow + (size_t)y*rowSize, pSrcRow, rowSize);
 }
 
 // Draw pixel within an image
@@ -2827,6 +3682,14 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
     // Using Bresenham's algorithm as described in
     // Drawing Lines with Pixels - Joshua Scott - March 2012
     // https://classic.csunplugged.org/wp-content/uploads/2014/12/Lines.pdf
+    // NOTE: Consecutive pixels on the same row are filled as a single span
+
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
 
     int changeInX = (endPosX - startPosX);
     int absChangeInX = (changeInX < 0)? -changeInX : changeInX;
@@ -2864,8 +3727,6 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
         }
 
         stepV = (changeInY < 0)? -1 : 1;
-
-        ImageDrawPixel(dst, startU, startV, color);     // At this point they are correctly ordered...
     }
     else
     {
@@ -2893,22 +3754,47 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
         }
 
         stepV = (changeInX < 0)? -1 : 1;
-
-        ImageDrawPixel(dst, startV, startU, color);     // ... but need to be reversed here. Repeated in the main loop below
     }
 
-    // We already drew the start point. If we started at startU + 0, the line would be crooked and too short
-    for (int u = startU + 1, v = startV; u <= endU; u++)
+    if (reversedXY)
     {
-        if (P >= 0)
+        // At this point they are correctly ordered, pixels are accumulated into
+        // a row span until we stray too far from the direct line
+        int spanStartU = startU;
+        int v = startV;
+
+        for (int u = startU + 1; u <= endU; u++)
         {
-            v += stepV;     // Adjusts whenever we stray too far from the direct line. Details in the linked paper above
-            P += B;         // Remembers that we corrected our path
+            if (P >= 0)
+            {
+                ImageFillSpan(dst, spanStartU, u, v, pixel, bytesPerPixel);
+                spanStartU = u;
+
+                v += stepV;     // Adjusts whenever we stray too far from the direct line. Details in the linked paper above
+                P += B;         // Remembers that we corrected our path
+            }
+            else P += A;        // Remembers how far we are from the direct line
         }
-        else P += A;        // Remembers how far we are from the direct line
 
-        if (reversedXY) ImageDrawPixel(dst, u, v, color);
-        else ImageDrawPixel(dst, v, u, color);
+        ImageFillSpan(dst, spanStartU, endU + 1, v, pixel, bytesPerPixel);
+    }
+    else
+    {
+        // Coordinates need to be reversed here, every pixel is on a different row
+        ImageFillSpan(dst, startV, startV + 1, startU, pixel, bytesPerPixel);
+
+        // We already drew the start point. If we started at startU + 0, the line would be crooked and too short
+        for (int u = startU + 1, v = startV; u <= endU; u++)
+        {
+            if (P >= 0)
+            {
+                v += stepV;     // Adjusts whenever we stray too far from the direct line. Details in the linked paper above
+                P += B;         // Remembers that we corrected our path
+            }
+            else P += A;        // Remembers how far we are from the direct line
+
+            ImageFillSpan(dst, v, v + 1, u, pixel, bytesPerPixel);
+        }
     }
 }
 
@@ -2918,19 +3804,98 @@ void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
     ImageDrawLine(dst, (int)start.x, (int)start.y, (int)end.x, (int)end.y, color);
 }
 
+// Draw antialiased line within an image (alpha blended)
+// NOTE: Using Xiaolin Wu's algorithm, pixel (x, y) center is at (x + 0.5f, y + 0.5f)
+void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (color.a == 0)) return;
+
+    // Move to pixel centers coordinates space
+    float x0 = start.x - 0.5f;
+    float y0 = start.y - 0.5f;
+    float x1 = end.x - 0.5f;
+    float y1 = end.y - 0.5f;
+    float temp = 0.0f;
+
+    // Always step along the major axis (U), in increasing order
+    bool steep = (fabsf(y1 - y0) > fabsf(x1 - x0));
+    if (steep) { temp = x0; x0 = y0; y0 = temp; temp = x1; x1 = y1; y1 = temp; }
+    if (x0 > x1) { temp = x0; x0 = x1; x1 = temp; temp = y0; y0 = y1; y1 = temp; }
+
+    int sizeU = steep? dst->height : dst->width;
+    int sizeV = steep? dst->width : dst->height;
+
+    // Line is rejected if its minor axis range (V) misses the image
+    if ((fmaxf(y0, y1) < -1.0f) || (fminf(y0, y1) >= (float)sizeV)) return;
+
+    // Major axis range is clipped to image, endpoints are kept as floats (no int overflow)
+    float startU = floorf(x0 + 0.5f);
+    float endU = floorf(x1 + 0.5f);
+    if (!((endU >= 0.0f) && (startU < (float)sizeU))) return;      // NOTE: NaN coordinates also rejected
+
+    int clipStartU = (startU < 0.0f)? 0 : (int)startU;
+    int clipEndU = (endU > (float)(sizeU - 1))? sizeU - 1 : (int)endU;
+
+    float gradient = ((x1 - x0) > 0.0f)? (y1 - y0)/(x1 - x0) : 0.0f;
+
+    for (int u = clipStartU; u <= clipEndU; u++)
+    {
+        // Endpoints pixels are only partially covered along the major axis
+        float coverage = 1.0f;
+        if ((float)u == startU) coverage -= (x0 + 0.5f - startU);
+        if ((float)u == endU) coverage -= (1.0f - (x1 + 0.5f - endU));
+        if (coverage <= 0.0f) continue;
+
+        // Line coverage is split between the two nearest pixels on the minor axis (V)
+        float v = y0 + gradient*((float)u - x0);
+        if (!((v >= -1.0f) && (v < (float)sizeV))) continue;
+
+        int iv = (int)floorf(v);
+        float fv = v - (float)iv;
+
+        Color color0 = color;
+        Color color1 = color;
+        color0.a = (unsigned char)((float)color.a*coverage*(1.0f - fv) + 0.5f);
+        color1.a = (unsigned char)((float)color.a*coverage*fv + 0.5f);
+
+        if (steep)
+        {
+            ImageBlendSpan(dst, iv, iv + 1, u, color0);
+            ImageBlendSpan(dst, iv + 1, iv + 2, u, color1);
+        }
+        else
+        {
+            ImageBlendSpan(dst, u, u + 1, iv, color0);
+            ImageBlendSpan(dst, u, u + 1, iv + 1, color1);
+        }
+    }
+}
+
 // Draw circle within an image
 void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        // NOTE: Empty spans (x or y equal to 0) fill one pixel, as rectangles drawing did
+        int widthX = (x > 0)? x*2 : 1;
+        int widthY = (y > 0)? y*2 : 1;
+
+        ImageFillSpan(dst, centerX - x, centerX - x + widthX, centerY + y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - x, centerX - x + widthX, centerY - y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerX - y + widthY, centerY + x, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerX - y + widthY, centerY - x, pixel, bytesPerPixel);
         x++;
 
         if (decesionParameter > 0)
@@ -2948,23 +3913,84 @@ void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
     ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
 }
 
+// Draw antialiased filled circle within an image (alpha blended)
+// NOTE: Pixel coverage is approximated by pixel center distance to circle edge,
+// fully covered pixels of every row are blended as a single span
+void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (color.a == 0) || (radius <= 0.0f)) return;
+
+    float outerRadius = radius + 0.5f;
+    float innerRadius = radius - 0.5f;
+
+    int startY = (int)floorf(center.y - outerRadius);
+    int endY = (int)ceilf(center.y + outerRadius);
+    if (startY < 0) startY = 0;
+    if (endY > dst->height) endY = dst->height;
+
+    for (int y = startY; y < endY; y++)
+    {
+        float dy = (float)y + 0.5f - center.y;
+        float outerSqr = outerRadius*outerRadius - dy*dy;
+        if (outerSqr <= 0.0f) continue;
+
+        float outerHalfWidth = sqrtf(outerSqr);
+        float innerHalfWidth = ((innerRadius > 0.0f) && (innerRadius*innerRadius > dy*dy))? sqrtf(innerRadius*innerRadius - dy*dy) : -1.0f;
+
+        // Pixels with center inside the inner circle are fully covered
+        int spanStartX = (int)ceilf(center.x - innerHalfWidth - 0.5f);
+        int spanEndX = (int)floorf(center.x + innerHalfWidth - 0.5f) + 1;
+        if (spanEndX < spanStartX) spanStartX = spanEndX = (int)floorf(center.x);
+
+        ImageBlendSpan(dst, spanStartX, spanEndX, y, color);
+
+        // Edge pixels, on both sides of the fully covered span
+        int startX = (int)floorf(center.x - outerHalfWidth - 0.5f);
+        int endX = (int)ceilf(center.x + outerHalfWidth - 0.5f);
+        if (startX < 0) startX = 0;
+        if (endX >= dst->width) endX = dst->width - 1;
+
+        for (int x = startX; x <= endX; x++)
+        {
+            if ((x >= spanStartX) && (x < spanEndX)) { x = spanEndX - 1; continue; }
+
+            float dx = (float)x + 0.5f - center.x;
+            float coverage = radius + 0.5f - sqrtf(dx*dx + dy*dy);
+            if (coverage <= 0.0f) continue;
+            if (coverage > 1.0f) coverage = 1.0f;
+
+            Color edgeColor = color;
+            edgeColor.a = (unsigned char)((float)color.a*coverage + 0.5f);
+            ImageBlendSpan(dst, x, x + 1, y, edgeColor);
+        }
+    }
+}
+
 // Draw circle outline within an image
 void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        ImageFillSpan(dst, centerX + x, centerX + x + 1, centerY + y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - x, centerX - x + 1, centerY + y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + x, centerX + x + 1, centerY - y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - x, centerX - x + 1, centerY - y, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + y, centerX + y + 1, centerY + x, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerX - y + 1, centerY + x, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + y, centerX + y + 1, centerY - x, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerX - y + 1, centerY - x, pixel, bytesPerPixel);
         x++;
 
         if (decesionParameter > 0)
@@ -3000,27 +4026,29 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
     int sy = (int)rec.y;
     int ey = sy + (int)rec.height;
-
     int sx = (int)rec.x;
+    int ex = sx + (int)rec.width;
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Clip rectangle to image bounds
+    if (sy < 0) sy = 0;
+    if (ey > dst->height) ey = dst->height;
+    if (sx < 0) sx = 0;
+    if (ex > dst->width) ex = dst->width;
+    if ((sy >= ey) || (sx >= ex)) return;
 
-    for (int y = sy; y < ey; y++)
-    {
-        // Fill in the first pixel of the row based on image format
-        ImageDrawPixel(dst, sx, y, color);
+    // Fill in the first row span, then repeat it throughout the rectangle
+    int spanSize = (ex - sx)*bytesPerPixel;
+    unsigned char *pSrcSpan = (unsigned char *)dst->data + ((size_t)sy*dst->width + sx)*bytesPerPixel;
 
-        int bytesOffset = ((y * dst->width) + sx) * bytesPerPixel;
-        unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+    ImageFillSpan(dst, sx, ex, sy, pixel, bytesPerPixel);
 
-        // Repeat the first pixel data throughout the row
-        for (int x = 1; x < (int)rec.width; x++)
-        {
-            memcpy(pSrcPixel + x * bytesPerPixel, pSrcPixel, bytesPerPixel);
-        }
-    }
+    for (int y = sy + 1; y < ey; y++) memcpy(pSrcSpan + (size_t)(y - sy)*dst->width*bytesPerPixel, pSrcSpan, spanSize);
 }
 
 // Draw rectangle lines within an image
@@ -3032,9 +4060,46 @@ void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
     ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
 }
 
+// Draw triangle within an image
+void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    Vector2 points[3] = { v1, v2, v3 };
+
+    ImageFillPolygon(dst, points, 3, color);
+}
+
+// Draw triangle outline within an image
+void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
+    ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
+    ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
+}
+
+// Draw polygon within an image
+// NOTE: Polygon is closed automatically, self-intersecting and concave polygons are
+// supported (even-odd rule), pixels are filled when their center is inside the polygon
+void ImageDrawPolygon(Image *dst, Vector2 *points, int pointCount, Color color)
+{
+    if ((points == NULL) || (pointCount < 3)) return;
+
+    ImageFillPolygon(dst, points, pointCount, color);
+}
+
 // Draw an image (source) within an image (destination)
 // NOTE: Color tint is applied to source image
 void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    // Security check to avoid program crash
+    if ((src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+
+    // NOTE: Source rectangle is drawn through a view, no source copy required (unless resized)
+    ImageDrawView(dst, GetImageView(src, srcRec), dstRec, tint);
+}
+
+// Draw a source image view within a destination image (tint applied to source)
+// NOTE: Source view is resized to destination rectangle size if required (source copy)
+void ImageDrawView(Image *dst, ImageView src, Rectangle dstRec, Color tint)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
@@ -3045,27 +4110,38 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
     else
     {
         Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
+        unsigned char *srcResized = NULL;   // Source resized pixels (transient, 8 bit per channel formats)
 
-        // Source rectangle out-of-bounds security checks
-        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
-        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
-        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
-        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
-
-        // Check if source rectangle needs to be resized to destination rectangle
+        // Check if source view needs to be resized to destination rectangle
         // In that case, we make a copy of source, and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        if ((src.width != (int)dstRec.width) || (src.height != (int)dstRec.height))
         {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+            int channels = 0;
+            if (src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+            else if (src.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+            else if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+            else if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+
+            if (channels > 0) srcResized = (unsigned char *)LoadImageScratch((int)dstRec.width*(int)dstRec.height*channels);
+
+            if (srcResized != NULL)
+            {
+                // Fast path: Resize source view rows directly into transient buffer, no source copy
+                stbir_resize_uint8((unsigned char *)src.data, src.width, src.height, src.stride, srcResized, (int)dstRec.width, (int)dstRec.height, 0, channels);
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
+                src = (ImageView){ srcResized, (int)dstRec.width, (int)dstRec.height, (int)dstRec.width*channels, src.format };
+            }
+            else
+            {
+                srcMod = ImageFromView(src);        // Create image from source view
+                ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
+
+                src = GetImageView(srcMod, (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height });
+            }
         }
 
+        Rectangle srcRec = { 0, 0, (float)src.width, (float)src.height };
+
         // Destination rectangle out-of-bounds security checks
         if (dstRec.x < 0)
         {
@@ -3089,7 +4165,7 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         // This blitting method is quite fast! The process followed is:
         // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
         // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
+        //    [x] Avoid creating source copy if not required (no resize required, source is a view)
         //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
         //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
         //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
@@ -3104,15 +4180,15 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         bool blendRequired = true;
 
         // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+        if ((tint.a == 255) && ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
 
         int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
         int bytesPerPixelDst = strideDst/(dst->width);
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+        int strideSrc = src.stride;
+        int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+        unsigned char *pSrcBase = (unsigned char *)src.data + (int)srcRec.y*strideSrc + (int)srcRec.x*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
         for (int y = 0; y < (int)srcRec.height; y++)
@@ -3121,12 +4197,12 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
             unsigned char *pDst = pDstBase;
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            if (!blendRequired && (src.format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
                 {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
+                    colSrc = GetPixelColor(pSrc, src.format);
                     colDst = GetPixelColor(pDst, dst->format);
 
                     // Fast path: Avoid blend if source has no alpha to blend
@@ -3144,7 +4220,8 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
             pDstBase += strideDst;
         }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+        UnloadImage(srcMod);        // Unload source modified image (if required)
+        UnloadImageScratch(srcResized);
     }
 }
 
@@ -3181,7 +4258,12 @@ Texture2D LoadTexture(const char *fileName)
 {
     Texture2D texture = { 0 };
 
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+    // Load processed image from import cache if set (cache miss imports the image)
+    Image image = (textureImportCachePath[0] != '\0')? LoadImageImported(fileName, textureImportFormat, textureImportFlags) : LoadImage(fileName);
+#else
     Image image = LoadImage(fileName);
+#endif
 
     if (image.data != NULL)
     {
@@ -3395,6 +4477,280 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+// Update GPU texture rectangle with image view data
+// NOTE: View pixel format must match texture format, rectangle size is clamped to view size
+void UpdateTextureRecView(Texture2D texture, Rectangle rec, ImageView view)
+{
+    if (view.data == NULL) return;
+
+    if (view.format != texture.format)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update, image view format does not match texture format", texture.id);
+        return;
+    }
+
+    int width = ((int)rec.width < view.width)? (int)rec.width : view.width;
+    int height = ((int)rec.height < view.height)? (int)rec.height : view.height;
+
+    rlUpdateTextureStride(texture.id, (int)rec.x, (int)rec.y, width, height, texture.format, view.data, view.stride);
+}
+
+//------------------------------------------------------------------------------------
+// Stream texture functions
+//------------------------------------------------------------------------------------
+// Load texture for streaming updates
+// NOTE: Every upload uses the next pixel buffer of the ring, so CPU writes never wait
+// for the GPU to finish reading the data of previous uploads
+StreamTexture LoadStreamTexture(int width, int height, int format)
+{
+    StreamTexture stream = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load stream texture, invalid size or pixel format");
+        return stream;
+    }
+
+    stream.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+
+    if (stream.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load stream texture");
+        return stream;
+    }
+
+    stream.texture.width = width;
+    stream.texture.height = height;
+    stream.texture.mipmaps = 1;
+    stream.texture.format = format;
+
+    int size = GetPixelDataSize(width, height, format);
+
+    stream.buffers = (unsigned int *)RL_CALLOC(STREAM_TEXTURE_BUFFERS, sizeof(unsigned int));
+
+    for (int i = 0; i < STREAM_TEXTURE_BUFFERS; i++)
+    {
+        stream.buffers[i] = rlLoadPixelBuffer(size);
+
+        if (stream.buffers[i] == 0) break;
+        stream.bufferCount++;
+    }
+
+    if (stream.bufferCount == 0)
+    {
+        // Pixel buffers not supported, locked data is uploaded from staging memory
+        RL_FREE(stream.buffers);
+        stream.buffers = NULL;
+        stream.staging = RL_MALLOC(size);
+    }
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Stream texture loaded successfully (%ix%i, %i pixel buffers)", stream.texture.id, width, height, stream.bufferCount);
+
+    return stream;
+}
+
+// Check if a stream texture is ready
+bool IsStreamTextureReady(StreamTexture stream)
+{
+    return (IsTextureReady(stream.texture) &&
+            ((stream.bufferCount > 0) || (stream.staging != NULL)));    // Validate pixel buffers or staging memory
+}
+
+// Unload stream texture from GPU memory (VRAM)
+void UnloadStreamTexture(StreamTexture stream)
+{
+    for (int i = 0; i < stream.bufferCount; i++) rlUnloadPixelBuffer(stream.buffers[i]);
+
+    RL_FREE(stream.buffers);
+    RL_FREE(stream.staging);
+
+    UnloadTexture(stream.texture);
+}
+
+// Lock stream texture rectangle for writing
+// NOTE: Returned pixel data is mapped driver memory (if supported), it must be fully written
+// (previous content is undefined) with rows packed, rectangle is clipped to texture bounds
+void *LockStreamTexture(StreamTexture *stream, Rectangle rec)
+{
+    void *data = NULL;
+
+    if (stream->texture.id == 0) return NULL;
+
+    if (stream->lockRec.width > 0)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Stream texture already locked", stream->texture.id);
+        return NULL;
+    }
+
+    rec = GetTextureClippedRec(stream->texture, rec);
+    if ((rec.width <= 0) || (rec.height <= 0)) return NULL;
+
+    if (stream->bufferCount > 0)
+    {
+        int size = GetPixelDataSize((int)rec.width, (int)rec.height, stream->texture.format);
+
+        data = rlMapPixelBuffer(stream->buffers[stream->currentBuffer], size);
+    }
+    else data = stream->staging;
+
+    if (data != NULL) stream->lockRec = rec;
+
+    return data;
+}
+
+// Unlock stream texture, locked rectangle is uploaded
+void UnlockStreamTexture(StreamTexture *stream)
+{
+    Rectangle rec = stream->lockRec;
+
+    if (rec.width <= 0) return;
+
+    if (stream->bufferCount > 0)
+    {
+        unsigned int bufferId = stream->buffers[stream->currentBuffer];
+
+        rlUnmapPixelBuffer(bufferId);
+        rlUpdateTextureFromPixelBuffer(stream->texture.id, bufferId, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, stream->texture.format, 0);
+
+        stream->currentBuffer = (stream->currentBuffer + 1)%stream->bufferCount;
+    }
+    else rlUpdateTexture(stream->texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, stream->texture.format, stream->staging);
+
+    stream->lockRec = (Rectangle){ 0 };
+}
+
+// Set stream texture rectangle as modified, uploaded on next update
+// NOTE: Overlapping rectangles are merged, when no room is left the new rectangle
+// is merged with the dirty rectangle whose area grows less
+void SetStreamTextureDirty(StreamTexture *stream, Rectangle rec)
+{
+    rec = GetTextureClippedRec(stream->texture, rec);
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
+
+    int maxDirtyRecs = sizeof(stream->dirtyRecs)/sizeof(Rectangle);
+    int mergeIndex = -1;
+    float minGrowth = 0.0f;
+
+    for (int i = 0; i < stream->dirtyCount; i++)
+    {
+        Rectangle dirty = stream->dirtyRecs[i];
+        float minX = (dirty.x < rec.x)? dirty.x : rec.x;
+        float minY = (dirty.y < rec.y)? dirty.y : rec.y;
+        float maxX = ((dirty.x + dirty.width) > (rec.x + rec.width))? (dirty.x + dirty.width) : (rec.x + rec.width);
+        float maxY = ((dirty.y + dirty.height) > (rec.y + rec.height))? (dirty.y + dirty.height) : (rec.y + rec.height);
+        float growth = (maxX - minX)*(maxY - minY) - dirty.width*dirty.height;
+
+        bool overlap = ((rec.x <= (dirty.x + dirty.width)) && (dirty.x <= (rec.x + rec.width)) &&
+                        (rec.y <= (dirty.y + dirty.height)) && (dirty.y <= (rec.y + rec.height)));
+
+        if (overlap || ((stream->dirtyCount == maxDirtyRecs) && ((mergeIndex == -1) || (growth < minGrowth))))
+        {
+            mergeIndex = i;
+            minGrowth = growth;
+            if (overlap) break;
+        }
+    }
+
+    if (mergeIndex == -1) stream->dirtyRecs[stream->dirtyCount++] = rec;
+    else
+    {
+        Rectangle *dirty = &stream->dirtyRecs[mergeIndex];
+        float maxX = ((dirty->x + dirty->width) > (rec.x + rec.width))? (dirty->x + dirty->width) : (rec.x + rec.width);
+        float maxY = ((dirty->y + dirty->height) > (rec.y + rec.height))? (dirty->y + dirty->height) : (rec.y + rec.height);
+
+        if (rec.x < dirty->x) dirty->x = rec.x;
+        if (rec.y < dirty->y) dirty->y = rec.y;
+        dirty->width = maxX - dirty->x;
+        dirty->height = maxY - dirty->y;
+    }
+}
+
+// Update stream texture dirty rectangles from pixel data
+// NOTE: Pixel data must be texture size and format, it is only read for dirty rectangles;
+// if pixel buffers are not supported, data is uploaded directly with no intermediate copy
+void UpdateStreamTexture(StreamTexture *stream, const void *pixels)
+{
+    if ((stream->texture.id == 0) || (pixels == NULL) || (stream->dirtyCount == 0)) return;
+
+    int pixelSize = GetPixelDataSize(1, 1, stream->texture.format);
+    int stride = stream->texture.width*pixelSize;
+
+    if (stream->bufferCount > 0)
+    {
+        // Dirty rectangles data must fit in one pixel buffer, otherwise their union is uploaded
+        int size = 0;
+        for (int i = 0; i < stream->dirtyCount; i++) size += (int)stream->dirtyRecs[i].width*(int)stream->dirtyRecs[i].height*pixelSize;
+
+        if (size > stride*stream->texture.height)
+        {
+            float minX = stream->dirtyRecs[0].x;
+            float minY = stream->dirtyRecs[0].y;
+            float maxX = stream->dirtyRecs[0].x + stream->dirtyRecs[0].width;
+            float maxY = stream->dirtyRecs[0].y + stream->dirtyRecs[0].height;
+
+            for (int i = 1; i < stream->dirtyCount; i++)
+            {
+                Rectangle rec = stream->dirtyRecs[i];
+
+                if (rec.x < minX) minX = rec.x;
+                if (rec.y < minY) minY = rec.y;
+                if ((rec.x + rec.width) > maxX) maxX = rec.x + rec.width;
+                if ((rec.y + rec.height) > maxY) maxY = rec.y + rec.height;
+            }
+
+            stream->dirtyRecs[0] = (Rectangle){ minX, minY, maxX - minX, maxY - minY };
+            stream->dirtyCount = 1;
+
+            size = (int)stream->dirtyRecs[0].width*(int)stream->dirtyRecs[0].height*pixelSize;
+        }
+
+        // Copy dirty rectangles rows packed into next pixel buffer of the ring
+        unsigned int bufferId = stream->buffers[stream->currentBuffer];
+        unsigned char *data = (unsigned char *)rlMapPixelBuffer(bufferId, size);
+
+        if (data != NULL)
+        {
+            int offset = 0;
+
+            for (int i = 0; i < stream->dirtyCount; i++)
+            {
+                Rectangle rec = stream->dirtyRecs[i];
+                int rowSize = (int)rec.width*pixelSize;
+                const unsigned char *src = (const unsigned char *)pixels + (int)rec.y*stride + (int)rec.x*pixelSize;
+
+                for (int y = 0; y < (int)rec.height; y++) memcpy(data + offset + y*rowSize, src + y*stride, rowSize);
+                offset += rowSize*(int)rec.height;
+            }
+
+            rlUnmapPixelBuffer(bufferId);
+
+            offset = 0;
+
+            for (int i = 0; i < stream->dirtyCount; i++)
+            {
+                Rectangle rec = stream->dirtyRecs[i];
+
+                rlUpdateTextureFromPixelBuffer(stream->texture.id, bufferId, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, stream->texture.format, offset);
+                offset += (int)rec.width*(int)rec.height*pixelSize;
+            }
+
+            stream->currentBuffer = (stream->currentBuffer + 1)%stream->bufferCount;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < stream->dirtyCount; i++)
+        {
+            Rectangle rec = stream->dirtyRecs[i];
+
+            rlUpdateTextureStride(stream->texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, stream->texture.format,
+                (const unsigned char *)pixels + (int)rec.y*stride + (int)rec.x*pixelSize, stride);
+        }
+    }
+
+    stream->dirtyCount = 0;
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -4359,115 +5715,2395 @@ int GetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Get colors from pixel data, uncompressed formats only
+static void GetPixelDataColors(const void *data, int count, int format, Color *colors)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
-
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    for (int i = 0, k = 0; i < count; i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        switch (format)
         {
-            switch (image.format)
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                colors[i].r = ((unsigned char *)data)[i];
+                colors[i].g = ((unsigned char *)data)[i];
+                colors[i].b = ((unsigned char *)data)[i];
+                colors[i].a = 255;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                colors[i].r = ((unsigned char *)data)[k];
+                colors[i].g = ((unsigned char *)data)[k];
+                colors[i].b = ((unsigned char *)data)[k];
+                colors[i].a = ((unsigned char *)data)[k + 1];
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                colors[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                colors[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                colors[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                colors[i].a = 255;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                colors[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                colors[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                colors[i].r = ((unsigned char *)data)[k];
+                colors[i].g = ((unsigned char *)data)[k + 1];
+                colors[i].b = ((unsigned char *)data)[k + 2];
+                colors[i].a = ((unsigned char *)data)[k + 3];
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                colors[i].r = (unsigned char)((unsigned char *)data)[k];
+                colors[i].g = (unsigned char)((unsigned char *)data)[k + 1];
+                colors[i].b = (unsigned char)((unsigned char *)data)[k + 2];
+                colors[i].a = 255;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                colors[i].r = (unsigned char)(((float *)data)[k]*255.0f);
+                colors[i].g = 0;
+                colors[i].b = 0;
+                colors[i].a = 255;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                colors[i].r = (unsigned char)(((float *)data)[k]*255.0f);
+                colors[i].g = (unsigned char)(((float *)data)[k + 1]*255.0f);
+                colors[i].b = (unsigned char)(((float *)data)[k + 2]*255.0f);
+                colors[i].a = 255;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                colors[i].r = (unsigned char)(((float *)data)[k]*255.0f);
+                colors[i].g = (unsigned char)(((float *)data)[k]*255.0f);
+                colors[i].b = (unsigned char)(((float *)data)[k]*255.0f);
+                colors[i].a = (unsigned char)(((float *)data)[k]*255.0f);
 
-                    k += 4;
-                }
-                default: break;
-            }
+                k += 4;
+            } break;
+            default: break;
         }
     }
+}
 
-    return pixels;
+// Set pixel data from colors, uncompressed formats only
+// NOTE: Colors are converted as ImageDrawPixel() does, format checked once for all pixels
+static void SetPixelDataColors(void *data, int count, int format, const Color *colors)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+                ((unsigned char *)data)[i] = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+                ((unsigned char *)data)[i*2] = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+                ((unsigned char *)data)[i*2 + 1] = colors[i].a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round((float)colors[i].r/255.0f*31.0f));
+                unsigned char g = (unsigned char)(round((float)colors[i].g/255.0f*63.0f));
+                unsigned char b = (unsigned char)(round((float)colors[i].b/255.0f*31.0f));
+
+                ((unsigned short *)data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round((float)colors[i].r/255.0f*31.0f));
+                unsigned char g = (unsigned char)(round((float)colors[i].g/255.0f*31.0f));
+                unsigned char b = (unsigned char)(round((float)colors[i].b/255.0f*31.0f));
+                unsigned char a = ((float)colors[i].a/255.0f > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                ((unsigned short *)data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round((float)colors[i].r/255.0f*15.0f));
+                unsigned char g = (unsigned char)(round((float)colors[i].g/255.0f*15.0f));
+                unsigned char b = (unsigned char)(round((float)colors[i].b/255.0f*15.0f));
+                unsigned char a = (unsigned char)(round((float)colors[i].a/255.0f*15.0f));
+
+                ((unsigned short *)data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                ((unsigned char *)data)[i*3] = colors[i].r;
+                ((unsigned char *)data)[i*3 + 1] = colors[i].g;
+                ((unsigned char *)data)[i*3 + 2] = colors[i].b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(data, colors, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+                ((float *)data)[i] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                ((float *)data)[i*3] = (float)colors[i].r/255.0f;
+                ((float *)data)[i*3 + 1] = (float)colors[i].g/255.0f;
+                ((float *)data)[i*3 + 2] = (float)colors[i].b/255.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                ((float *)data)[i*4] = (float)colors[i].r/255.0f;
+                ((float *)data)[i*4 + 1] = (float)colors[i].g/255.0f;
+                ((float *)data)[i*4 + 2] = (float)colors[i].b/255.0f;
+                ((float *)data)[i*4 + 3] = (float)colors[i].a/255.0f;
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Get colors from pixel data row, converted into buffer if not R8G8B8A8
+static const Color *GetPixelRowColors(const void *data, int count, int format, Color *buffer)
+{
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (const Color *)data;
+
+    GetPixelDataColors(data, count, format, buffer);
+
+    return buffer;
+}
+
+// Get first pixel in range [start, end) with alpha over threshold, end if none
+// NOTE: Alpha values are checked in blocks of 16 pixels, no branch inside the block
+static int GetAlphaRowFirst(const Color *pixels, int start, int end, unsigned char threshold)
+{
+    int x = start;
+
+    for (; (x + 16) <= end; x += 16)
+    {
+        int found = 0;
+        for (int i = 0; i < 16; i++) found |= (pixels[x + i].a > threshold);
+        if (found) break;
+    }
+
+    for (; x < end; x++) if (pixels[x].a > threshold) return x;
+
+    return end;
+}
+
+// Get last pixel in range [start, end) with alpha over threshold, start - 1 if none
+static int GetAlphaRowLast(const Color *pixels, int start, int end, unsigned char threshold)
+{
+    int x = end;
+
+    for (; (x - 16) >= start; x -= 16)
+    {
+        int found = 0;
+        for (int i = 1; i <= 16; i++) found |= (pixels[x - i].a > threshold);
+        if (found) break;
+    }
+
+    for (; x > start; x--) if (pixels[x - 1].a > threshold) return x - 1;
+
+    return start - 1;
+}
+
+// Alpha borders job: get alpha border of a range of rectangles
+static void GetImageAlphaBordersJob(void *data, int start, int end)
+{
+    AlphaBorderJobData *job = (AlphaBorderJobData *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        Rectangle rec = job->recs[i];
+        Rectangle border = GetImageViewAlphaBorder(GetImageView(job->image, rec), job->threshold);
+
+        // NOTE: View rectangle origin is clamped to image bounds
+        float viewX = (rec.x > 0)? (float)((int)rec.x) : 0.0f;
+        float viewY = (rec.y > 0)? (float)((int)rec.y) : 0.0f;
+
+        if ((border.width > 0) && (border.height > 0)) job->recs[i] = (Rectangle){ viewX + border.x, viewY + border.y, border.width, border.height };
+        else job->recs[i] = (Rectangle){ rec.x, rec.y, 0, 0 };
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Alpha crop job: crop a range of images
+static void ImageAlphaCropBatchJob(void *data, int start, int end)
+{
+    AlphaBorderJobData *job = (AlphaBorderJobData *)data;
+
+    for (int i = start; i < end; i++) ImageAlphaCrop(&job->images[i], job->threshold);
+}
+#endif
+
+// Allocate transient buffer, from image scratch arena if available (heap otherwise)
+// NOTE: Buffers must be freed with UnloadImageScratch(), arena blocks are stacked and
+// memory is reclaimed once all blocks allocated later are also freed
+static void *LoadImageScratch(int size)
+{
+    if (size <= 0) return NULL;
+
+    int blockSize = (int)sizeof(ImageScratchBlock) + ((size + 15) & ~15);
+    ImageScratchBlock *block = NULL;
+
+    LockWorkerData();
+
+    if ((imageScratch != NULL) && ((imageScratchStats.arenaUsed + blockSize) <= imageScratchStats.capacity))
+    {
+        block = (ImageScratchBlock *)(imageScratch + imageScratchStats.arenaUsed);
+        block->size = blockSize;
+        block->previous = imageScratchLast;
+        block->freed = 0;
+
+        imageScratchLast = imageScratchStats.arenaUsed;
+        imageScratchStats.arenaUsed += blockSize;
+        if (imageScratchStats.arenaUsed > imageScratchStats.arenaPeak) imageScratchStats.arenaPeak = imageScratchStats.arenaUsed;
+        imageScratchStats.arenaAllocs++;
+    }
+
+    UnlockWorkerData();
+
+    bool heapBlock = (block == NULL);
+
+    if (heapBlock)
+    {
+        block = (ImageScratchBlock *)RL_MALLOC(blockSize);
+        if (block == NULL) return NULL;
+
+        block->size = blockSize;
+        block->previous = -1;
+        block->freed = 0;
+    }
+
+    LockWorkerData();
+
+    if (heapBlock) imageScratchStats.heapAllocs++;
+    imageScratchStats.transientUsed += blockSize;
+    if (imageScratchStats.transientUsed > imageScratchStats.transientPeak) imageScratchStats.transientPeak = imageScratchStats.transientUsed;
+
+    UnlockWorkerData();
+
+    return block + 1;
+}
+
+// Free transient buffer allocated with LoadImageScratch()
+static void UnloadImageScratch(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    ImageScratchBlock *block = (ImageScratchBlock *)ptr - 1;
+    bool heapBlock = false;
+
+    LockWorkerData();
+
+    imageScratchStats.transientUsed -= block->size;
+
+    if ((imageScratch != NULL) && ((unsigned char *)block >= imageScratch) && ((unsigned char *)block < (imageScratch + imageScratchStats.capacity)))
+    {
+        block->freed = 1;
+
+        // Reclaim arena memory from last block, down to first block still in use
+        while ((imageScratchLast != -1) && ((ImageScratchBlock *)(imageScratch + imageScratchLast))->freed)
+        {
+            imageScratchStats.arenaUsed = imageScratchLast;
+            imageScratchLast = ((ImageScratchBlock *)(imageScratch + imageScratchLast))->previous;
+        }
+    }
+    else heapBlock = true;
+
+    UnlockWorkerData();
+
+    if (heapBlock) RL_FREE(block);
+}
+
+// Load image pixel data as transient Color buffer (scratch)
+// NOTE: Same as LoadImageColors() but buffer must be freed with UnloadImageScratch()
+static Color *LoadImageScratchColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    Color *pixels = (Color *)LoadImageScratch(image.width*image.height*sizeof(Color));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else if (pixels != NULL) GetPixelDataColors(image.data, image.width*image.height, image.format, pixels);
+
+    return pixels;
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+// NOTE: Transient buffer, must be freed with UnloadImageScratch()
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)LoadImageScratch(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                }
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+
+// Load images job: load a range of images (files or memory buffers)
+static void LoadImagesJob(void *data, int start, int end)
+{
+    LoadImagesJobData *job = (LoadImagesJobData *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        if (job->fileNames != NULL)
+        {
+            if (job->fileNames[i] != NULL) job->images[i] = LoadImage(job->fileNames[i]);
+        }
+        else if ((job->fileTypes[i] != NULL) && (job->fileData[i] != NULL))
+        {
+            job->images[i] = LoadImageFromMemory(job->fileTypes[i], job->fileData[i], job->dataSizes[i]);
+        }
+    }
+}
+
+// Reset animation decoder to first frame (not decoded)
+// NOTE: currentFrame is set to -1, next decoded frame will be first frame
+static void ResetAnimImage(AnimImage *anim)
+{
+    AnimImageContext *ctx = (AnimImageContext *)anim->ctxData;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (anim->ctxType == ANIM_IMAGE_GIF)
+    {
+        RL_FREE(ctx->gif.out);
+        RL_FREE(ctx->gif.background);
+        RL_FREE(ctx->gif.history);
+
+        memset(&ctx->gif, 0, sizeof(stbi__gif));
+        stbi__start_mem(&ctx->gifStream, ctx->fileData, ctx->dataSize);
+
+        anim->image.data = NULL;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (anim->ctxType == ANIM_IMAGE_APNG)
+    {
+        // NOTE: First frame is composed over a fully transparent canvas
+        if (ctx->canvas != NULL) memset(ctx->canvas, 0, anim->image.width*anim->image.height*4);
+        ctx->disposeOp = 0;
+    }
+#endif
+
+    anim->currentFrame = -1;
+}
+
+// Decode next animation frame into anim->image
+static bool DecodeAnimImageFrame(AnimImage *anim)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (anim->ctxType == ANIM_IMAGE_GIF)
+    {
+        AnimImageContext *ctx = (AnimImageContext *)anim->ctxData;
+        stbi__gif *gif = &ctx->gif;
+        int frameSize = gif->w*gif->h*4;
+
+        // Keep current frame, it will be the previous frame of next one
+        unsigned char *twoBack = NULL;
+        if (gif->out != NULL)
+        {
+            if (ctx->gifScratch == NULL) ctx->gifScratch = (unsigned char *)RL_MALLOC(frameSize);
+            memcpy(ctx->gifScratch, gif->out, frameSize);
+            if (anim->currentFrame >= 1) twoBack = ctx->gifPrevious;
+        }
+
+        int comp = 0;
+        unsigned char *frame = stbi__gif_load_next(&ctx->gifStream, gif, &comp, 4, twoBack);
+
+        // NOTE: stb_image returns the stream pointer as end of animation marker
+        if ((frame != NULL) && (frame != (unsigned char *)&ctx->gifStream))
+        {
+            if (ctx->gifScratch != NULL)
+            {
+                unsigned char *temp = ctx->gifPrevious;
+                ctx->gifPrevious = ctx->gifScratch;
+                ctx->gifScratch = temp;
+            }
+
+            anim->image.data = frame;
+            anim->image.width = gif->w;
+            anim->image.height = gif->h;
+            anim->image.mipmaps = 1;
+            anim->image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            anim->frameDelay = gif->delay;
+            anim->currentFrame++;
+
+            // Frames count could be wrong on malformed files, trust decoder
+            if (anim->currentFrame >= anim->frameCount) anim->frameCount = anim->currentFrame + 1;
+
+            result = true;
+        }
+        else if (frame == (unsigned char *)&ctx->gifStream) anim->frameCount = anim->currentFrame + 1;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (anim->ctxType == ANIM_IMAGE_APNG) result = DecodeAnimPngFrame(anim);
+#endif
+
+    return result;
+}
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Get GIF frames count, parsing blocks structure (no decoding)
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize)
+{
+    int frameCount = 0;
+
+    if ((dataSize < 13) || (memcmp(fileData, "GIF", 3) != 0)) return 0;
+
+    // Skip header and logical screen descriptor, including global color table
+    int offset = 13;
+    if (fileData[10] & 0x80) offset += 3*(2 << (fileData[10] & 0x07));
+
+    while (offset < dataSize)
+    {
+        unsigned char block = fileData[offset++];
+
+        if (block == 0x2c)          // Image descriptor
+        {
+            if (offset + 9 > dataSize) break;
+
+            unsigned char flags = fileData[offset + 8];
+            offset += 9;
+            if (flags & 0x80) offset += 3*(2 << (flags & 0x07));    // Local color table
+            offset++;               // LZW minimum code size
+
+            frameCount++;
+        }
+        else if (block == 0x21) offset++;   // Extension block, skip label
+        else break;                 // Trailer (0x3b) or unknown block
+
+        // Skip data sub-blocks
+        while (offset < dataSize)
+        {
+            int length = fileData[offset++];
+            if (length == 0) break;
+            offset += length;
+        }
+    }
+
+    return frameCount;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Read big-endian 32bit unsigned value
+static unsigned int ReadUInt32BE(const unsigned char *data)
+{
+    return ((unsigned int)data[0] << 24) | ((unsigned int)data[1] << 16) | ((unsigned int)data[2] << 8) | (unsigned int)data[3];
+}
+
+// Write big-endian 32bit unsigned value
+static void WriteUInt32BE(unsigned char *data, unsigned int value)
+{
+    data[0] = (unsigned char)(value >> 24);
+    data[1] = (unsigned char)(value >> 16);
+    data[2] = (unsigned char)(value >> 8);
+    data[3] = (unsigned char)value;
+}
+
+// Init APNG frames index, returns false if PNG is not animated
+// NOTE: Only chunks structure is parsed, frames are decoded on demand
+static bool InitAnimPng(AnimImage *anim)
+{
+    AnimImageContext *ctx = (AnimImageContext *)anim->ctxData;
+    const unsigned char *data = ctx->fileData;
+    int dataSize = ctx->dataSize;
+
+    if ((dataSize < 8 + 25) || (memcmp(data, "\x89PNG\r\n\x1a\n", 8) != 0)) return false;
+
+    int frameCount = 0;
+    int frameIndex = 0;
+    bool imageDataFound = false;
+
+    ctx->pngHeaderOffset = 8;
+
+    for (int offset = 8; offset + 12 <= dataSize; )
+    {
+        unsigned int length = ReadUInt32BE(data + offset);
+        const unsigned char *type = data + offset + 4;
+
+        if ((length > (unsigned int)(dataSize - offset - 12))) break;
+
+        if (memcmp(type, "acTL", 4) == 0)
+        {
+            frameCount = (int)ReadUInt32BE(data + offset + 8);
+            if (frameCount <= 0) return false;
+
+            // NOTE: Frames count is limited by file size, every frame requires a fcTL chunk (38 bytes)
+            if (frameCount > dataSize/38) frameCount = dataSize/38;
+
+            ctx->pngFrameOffsets = (int *)RL_CALLOC(frameCount, sizeof(int));
+        }
+        else if (memcmp(type, "fcTL", 4) == 0)
+        {
+            if ((ctx->pngFrameOffsets != NULL) && (frameIndex < frameCount) && (length >= 26)) ctx->pngFrameOffsets[frameIndex++] = offset;
+        }
+        else if ((memcmp(type, "IDAT", 4) == 0) || (memcmp(type, "fdAT", 4) == 0))
+        {
+            if (!imageDataFound) ctx->pngHeaderSize = offset - ctx->pngHeaderOffset;
+            imageDataFound = true;
+        }
+        else if (memcmp(type, "IEND", 4) == 0) break;
+
+        offset += 12 + length;
+    }
+
+    if ((frameIndex == 0) || !imageDataFound)
+    {
+        RL_FREE(ctx->pngFrameOffsets);
+        ctx->pngFrameOffsets = NULL;
+        return false;
+    }
+
+    int width = (int)ReadUInt32BE(data + 16);
+    int height = (int)ReadUInt32BE(data + 20);
+
+    // NOTE: Canvas size is checked to fit on int bytes count (canvas is allocated as RGBA)
+    if ((width <= 0) || (height <= 0) || (width > (0x7fffffff/4)/height))
+    {
+        RL_FREE(ctx->pngFrameOffsets);
+        ctx->pngFrameOffsets = NULL;
+        return false;
+    }
+
+    anim->frameCount = frameIndex;
+    anim->image.width = width;
+    anim->image.height = height;
+    anim->image.mipmaps = 1;
+    anim->image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ctx->canvas = (unsigned char *)RL_CALLOC(anim->image.width*anim->image.height, 4);
+    anim->image.data = ctx->canvas;
+
+    return (ctx->canvas != NULL);
+}
+
+// Decode next APNG frame and compose it on canvas
+// NOTE: Every frame is rebuilt as an standalone PNG (shared header chunks + frame data chunks)
+static bool DecodeAnimPngFrame(AnimImage *anim)
+{
+    AnimImageContext *ctx = (AnimImageContext *)anim->ctxData;
+    const unsigned char *data = ctx->fileData;
+    int frame = anim->currentFrame + 1;
+
+    if (frame >= anim->frameCount) return false;
+
+    // Read frame control chunk
+    const unsigned char *fctl = data + ctx->pngFrameOffsets[frame] + 8;
+    int frameWidth = (int)ReadUInt32BE(fctl + 4);
+    int frameHeight = (int)ReadUInt32BE(fctl + 8);
+    int frameX = (int)ReadUInt32BE(fctl + 12);
+    int frameY = (int)ReadUInt32BE(fctl + 16);
+    int delayNum = (fctl[20] << 8) | fctl[21];
+    int delayDen = (fctl[22] << 8) | fctl[23];
+    int disposeOp = fctl[24];
+    int blendOp = fctl[25];
+
+    int canvasWidth = anim->image.width;
+    int canvasHeight = anim->image.height;
+
+    // NOTE: Frame region is checked without overflow, values are read as unsigned
+    if ((frameWidth <= 0) || (frameHeight <= 0) || (frameX < 0) || (frameY < 0) ||
+        (frameX > canvasWidth) || (frameY > canvasHeight) ||
+        (frameWidth > (canvasWidth - frameX)) || (frameHeight > (canvasHeight - frameY))) return false;
+
+    // Gather frame data chunks size (IDAT or fdAT until next fcTL)
+    int firstChunk = ctx->pngFrameOffsets[frame] + 12 + (int)ReadUInt32BE(data + ctx->pngFrameOffsets[frame]);
+    int pngSize = 8 + ctx->pngHeaderSize + 12;     // Signature + shared chunks + IEND
+
+    for (int offset = firstChunk; offset + 12 <= ctx->dataSize; )
+    {
+        unsigned int length = ReadUInt32BE(data + offset);
+        if (length > (unsigned int)(ctx->dataSize - offset - 12)) break;
+
+        if (memcmp(data + offset + 4, "IDAT", 4) == 0) pngSize += 12 + length;
+        else if (memcmp(data + offset + 4, "fdAT", 4) == 0) pngSize += 12 + length - 4;
+        else if ((memcmp(data + offset + 4, "fcTL", 4) == 0) || (memcmp(data + offset + 4, "IEND", 4) == 0)) break;
+
+        offset += 12 + length;
+    }
+
+    // Build standalone PNG for the frame
+    // NOTE: stb_image does not check chunks CRC, it's left as zero
+    unsigned char *png = (unsigned char *)RL_CALLOC(pngSize, 1);
+    int pngOffset = 0;
+
+    memcpy(png, data, 8);
+    pngOffset += 8;
+
+    for (int offset = ctx->pngHeaderOffset; offset < ctx->pngHeaderOffset + ctx->pngHeaderSize; )
+    {
+        unsigned int length = ReadUInt32BE(data + offset);
+
+        // Animation chunks are not copied
+        if ((memcmp(data + offset + 4, "acTL", 4) != 0) && (memcmp(data + offset + 4, "fcTL", 4) != 0))
+        {
+            memcpy(png + pngOffset, data + offset, 12 + length);
+
+            // Frame size is set on image header
+            if (memcmp(data + offset + 4, "IHDR", 4) == 0)
+            {
+                WriteUInt32BE(png + pngOffset + 8, frameWidth);
+                WriteUInt32BE(png + pngOffset + 12, frameHeight);
+            }
+
+            pngOffset += 12 + length;
+        }
+
+        offset += 12 + length;
+    }
+
+    for (int offset = firstChunk; offset + 12 <= ctx->dataSize; )
+    {
+        unsigned int length = ReadUInt32BE(data + offset);
+        if (length > (unsigned int)(ctx->dataSize - offset - 12)) break;
+
+        if (memcmp(data + offset + 4, "IDAT", 4) == 0)
+        {
+            memcpy(png + pngOffset, data + offset, 12 + length);
+            pngOffset += 12 + length;
+        }
+        else if (memcmp(data + offset + 4, "fdAT", 4) == 0)
+        {
+            // Frame data chunk includes a sequence number before image data
+            WriteUInt32BE(png + pngOffset, length - 4);
+            memcpy(png + pngOffset + 4, "IDAT", 4);
+            memcpy(png + pngOffset + 8, data + offset + 12, length - 4);
+            pngOffset += 12 + length - 4;
+        }
+        else if ((memcmp(data + offset + 4, "fcTL", 4) == 0) || (memcmp(data + offset + 4, "IEND", 4) == 0)) break;
+
+        offset += 12 + length;
+    }
+
+    WriteUInt32BE(png + pngOffset, 0);
+    memcpy(png + pngOffset + 4, "IEND", 4);
+    pngOffset += 12;
+
+    int width = 0, height = 0, comp = 0;
+    unsigned char *pixels = stbi_load_from_memory(png, pngOffset, &width, &height, &comp, 4);
+    RL_FREE(png);
+
+    if (pixels == NULL) return false;
+
+    // Apply previous frame dispose operation
+    unsigned char *canvas = ctx->canvas;
+    int disposeX = (int)ctx->disposeRec.x;
+    int disposeY = (int)ctx->disposeRec.y;
+    int disposeWidth = (int)ctx->disposeRec.width;
+
+    if (ctx->disposeOp == 1)            // APNG_DISPOSE_OP_BACKGROUND
+    {
+        for (int y = disposeY; y < disposeY + (int)ctx->disposeRec.height; y++) memset(canvas + (y*canvasWidth + disposeX)*4, 0, disposeWidth*4);
+    }
+    else if (ctx->disposeOp == 2)       // APNG_DISPOSE_OP_PREVIOUS
+    {
+        for (int y = 0; y < (int)ctx->disposeRec.height; y++) memcpy(canvas + ((disposeY + y)*canvasWidth + disposeX)*4, ctx->backup + y*disposeWidth*4, disposeWidth*4);
+    }
+
+    // NOTE: First frame can not be restored to previous, it's cleared instead
+    if ((disposeOp == 2) && (frame == 0)) disposeOp = 1;
+
+    if (disposeOp == 2)
+    {
+        if (ctx->backup == NULL) ctx->backup = (unsigned char *)RL_MALLOC(canvasWidth*canvasHeight*4);
+        for (int y = 0; y < frameHeight; y++) memcpy(ctx->backup + y*frameWidth*4, canvas + ((frameY + y)*canvasWidth + frameX)*4, frameWidth*4);
+    }
+
+    ctx->disposeOp = disposeOp;
+    ctx->disposeRec = (Rectangle){ (float)frameX, (float)frameY, (float)frameWidth, (float)frameHeight };
+
+    // Compose frame on canvas
+    for (int y = 0; y < frameHeight; y++)
+    {
+        unsigned char *dst = canvas + ((frameY + y)*canvasWidth + frameX)*4;
+        const unsigned char *src = pixels + y*frameWidth*4;
+
+        if (blendOp == 0) memcpy(dst, src, frameWidth*4);   // APNG_BLEND_OP_SOURCE
+        else                                                // APNG_BLEND_OP_OVER
+        {
+            for (int x = 0; x < frameWidth; x++, dst += 4, src += 4)
+            {
+                int srcAlpha = src[3];
+
+                if (srcAlpha == 255) memcpy(dst, src, 4);
+                else if (srcAlpha > 0)
+                {
+                    int dstAlpha = dst[3]*(255 - srcAlpha)/255;
+                    int outAlpha = srcAlpha + dstAlpha;
+
+                    for (int c = 0; c < 3; c++) dst[c] = (unsigned char)((src[c]*srcAlpha + dst[c]*dstAlpha)/outAlpha);
+                    dst[3] = (unsigned char)outAlpha;
+                }
+            }
+        }
+    }
+
+    RL_FREE(pixels);
+
+    anim->frameDelay = (delayNum*1000)/((delayDen == 0)? 100 : delayDen);
+    anim->currentFrame = frame;
+
+    return true;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Set color lookup tables to identity (no color change)
+static void SetColorLUTIdentity(unsigned char lut[4][256])
+{
+    for (int i = 0; i < 256; i++)
+    {
+        lut[0][i] = (unsigned char)i;
+        lut[1][i] = (unsigned char)i;
+        lut[2][i] = (unsigned char)i;
+        lut[3][i] = (unsigned char)i;
+    }
+}
+
+// Append tint to color lookup tables
+static void SetColorLUTTint(unsigned char lut[4][256], Color color)
+{
+    float cR = (float)color.r/255;
+    float cG = (float)color.g/255;
+    float cB = (float)color.b/255;
+    float cA = (float)color.a/255;
+
+    for (int i = 0; i < 256; i++)
+    {
+        lut[0][i] = (unsigned char)(((float)lut[0][i]/255*cR)*255.0f);
+        lut[1][i] = (unsigned char)(((float)lut[1][i]/255*cG)*255.0f);
+        lut[2][i] = (unsigned char)(((float)lut[2][i]/255*cB)*255.0f);
+        lut[3][i] = (unsigned char)(((float)lut[3][i]/255*cA)*255.0f);
+    }
+}
+
+// Append contrast to color lookup tables (alpha not modified)
+// NOTE: Contrast values between -100 and 100
+static void SetColorLUTContrast(unsigned char lut[4][256], float contrast)
+{
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    for (int c = 0; c < 3; c++)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            float value = (float)lut[c][i]/255.0f;
+            value -= 0.5f;
+            value *= contrast;
+            value += 0.5f;
+            value *= 255;
+            if (value < 0) value = 0;
+            if (value > 255) value = 255;
+
+            lut[c][i] = (unsigned char)value;
+        }
+    }
+}
+
+// Append brightness to color lookup tables (alpha not modified)
+// NOTE: Brightness values between -255 and 255
+static void SetColorLUTBrightness(unsigned char lut[4][256], int brightness)
+{
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    for (int c = 0; c < 3; c++)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            int value = lut[c][i] + brightness;
+
+            if (value < 0) value = 1;
+            if (value > 255) value = 255;
+
+            lut[c][i] = (unsigned char)value;
+        }
+    }
+}
+
+// Get grayscale value for color, same conversion used by ImageFormat()
+static unsigned char GetColorLUTGray(unsigned char r, unsigned char g, unsigned char b)
+{
+    return (unsigned char)((((float)r/255.0f)*0.299f + ((float)g/255.0f)*0.587f + ((float)b/255.0f)*0.114f)*255.0f);
+}
+
+// Apply color lookup tables to image, with optional grayscale blend (0..256) applied first
+// NOTE: 8-bit per channel formats are processed in-place (including mipmaps), using integer operations only,
+// other formats are converted to R8G8B8A8 and back
+static void ImageApplyColorLUT(Image *image, unsigned char lut[4][256], int grayscale)
+{
+    unsigned char *data = (unsigned char *)image->data;
+    int pixelCount = 0;
+
+    // Pixels count including all mipmap levels
+    for (int i = 0, width = image->width, height = image->height; i < ((image->mipmaps > 1)? image->mipmaps : 1); i++)
+    {
+        pixelCount += width*height;
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // Gray values are converted to RGB, adjusted and converted back to gray
+            // NOTE: Grayscale blend does not modify gray values
+            unsigned char grayLut[256] = { 0 };
+            for (int i = 0; i < 256; i++) grayLut[i] = GetColorLUTGray(lut[0][i], lut[1][i], lut[2][i]);
+
+            if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                for (int i = 0; i < pixelCount; i++) data[i] = grayLut[data[i]];
+            }
+            else
+            {
+                for (int i = 0; i < pixelCount*2; i += 2)
+                {
+                    data[i] = grayLut[data[i]];
+                    data[i + 1] = lut[3][data[i + 1]];
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            int channels = (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 4;
+
+            for (int i = 0; i < pixelCount*channels; i += channels)
+            {
+                int r = data[i];
+                int g = data[i + 1];
+                int b = data[i + 2];
+
+                if (grayscale > 0)
+                {
+                    // Luminance in fixed point: 0.299, 0.587, 0.114 scaled by 256
+                    int gray = (77*r + 150*g + 29*b) >> 8;
+
+                    r += ((gray - r)*grayscale) >> 8;
+                    g += ((gray - g)*grayscale) >> 8;
+                    b += ((gray - b)*grayscale) >> 8;
+                }
+
+                data[i] = lut[0][r];
+                data[i + 1] = lut[1][g];
+                data[i + 2] = lut[2][b];
+                if (channels == 4) data[i + 3] = lut[3][data[i + 3]];
+            }
+        } break;
+        default:
+        {
+            Color *pixels = LoadImageColors(*image);
+
+            Image temp = { pixels, image->width, image->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            ImageApplyColorLUT(&temp, lut, grayscale);
+
+            int format = image->format;
+            RL_FREE(image->data);
+
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            ImageFormat(image, format);
+        } break;
+    }
+}
+
+// Reverse pixels order in place, pixel i swapped with pixel (count - 1 - i)
+// NOTE: Specialized for common pixel sizes, other sizes are swapped byte by byte
+static void ReverseImagePixels(unsigned char *data, int count, int bytesPerPixel)
+{
+    #define REVERSE_PIXELS(type) \
+    { \
+        type *first = (type *)data; \
+        type *last = first + count - 1; \
+        for (; first < last; first++, last--) { type temp = *first; *first = *last; *last = temp; } \
+    }
+
+    switch (bytesPerPixel)
+    {
+        case 1: REVERSE_PIXELS(unsigned char); break;
+        case 2: REVERSE_PIXELS(unsigned short); break;
+        case 4: REVERSE_PIXELS(unsigned int); break;
+        default:
+        {
+            unsigned char *first = data;
+            unsigned char *last = data + (count - 1)*bytesPerPixel;
+
+            for (; first < last; first += bytesPerPixel, last -= bytesPerPixel)
+            {
+                for (int i = 0; i < bytesPerPixel; i++)
+                {
+                    unsigned char temp = first[i];
+                    first[i] = last[i];
+                    last[i] = temp;
+                }
+            }
+        } break;
+    }
+
+    #undef REVERSE_PIXELS
+}
+
+// Transpose square image pixels in place, processed by blocks to keep both blocks in cache
+static void TransposeImagePixels(unsigned char *data, int size, int bytesPerPixel)
+{
+    #define TRANSPOSE_BLOCK(type) \
+    { \
+        type *pixels = (type *)data; \
+        for (int y = by; y < byEnd; y++) \
+        { \
+            for (int x = (bx == by)? (y + 1) : bx; x < bxEnd; x++) \
+            { \
+                type temp = pixels[y*size + x]; \
+                pixels[y*size + x] = pixels[x*size + y]; \
+                pixels[x*size + y] = temp; \
+            } \
+        } \
+    }
+
+    for (int by = 0; by < size; by += IMAGE_TRANSFORM_BLOCK_SIZE)
+    {
+        int byEnd = ((by + IMAGE_TRANSFORM_BLOCK_SIZE) < size)? (by + IMAGE_TRANSFORM_BLOCK_SIZE) : size;
+
+        // NOTE: Only blocks on and above the diagonal are processed, swapped with their mirror blocks
+        for (int bx = by; bx < size; bx += IMAGE_TRANSFORM_BLOCK_SIZE)
+        {
+            int bxEnd = ((bx + IMAGE_TRANSFORM_BLOCK_SIZE) < size)? (bx + IMAGE_TRANSFORM_BLOCK_SIZE) : size;
+
+            switch (bytesPerPixel)
+            {
+                case 1: TRANSPOSE_BLOCK(unsigned char); break;
+                case 2: TRANSPOSE_BLOCK(unsigned short); break;
+                case 4: TRANSPOSE_BLOCK(unsigned int); break;
+                default:
+                {
+                    for (int y = by; y < byEnd; y++)
+                    {
+                        for (int x = (bx == by)? (y + 1) : bx; x < bxEnd; x++)
+                        {
+                            unsigned char *a = data + (y*size + x)*bytesPerPixel;
+                            unsigned char *b = data + (x*size + y)*bytesPerPixel;
+
+                            for (int i = 0; i < bytesPerPixel; i++)
+                            {
+                                unsigned char temp = a[i];
+                                a[i] = b[i];
+                                b[i] = temp;
+                            }
+                        }
+                    }
+                } break;
+            }
+        }
+    }
+
+    #undef TRANSPOSE_BLOCK
+}
+
+// Copy image pixels into transformed positions, processed by blocks
+// NOTE: Source pixel (x, y) is copied to destination pixel index: origin + x*stepX + y*stepY
+static void TransformImagePixels(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, int origin, int stepX, int stepY)
+{
+    #define TRANSFORM_BLOCK(type) \
+    { \
+        for (int y = by; y < byEnd; y++) \
+        { \
+            const type *srcPixel = (const type *)src + y*width + bx; \
+            type *dstPixel = (type *)dst + origin + y*stepY + bx*stepX; \
+            for (int x = bx; x < bxEnd; x++, srcPixel++, dstPixel += stepX) *dstPixel = *srcPixel; \
+        } \
+    }
+
+    for (int by = 0; by < height; by += IMAGE_TRANSFORM_BLOCK_SIZE)
+    {
+        int byEnd = ((by + IMAGE_TRANSFORM_BLOCK_SIZE) < height)? (by + IMAGE_TRANSFORM_BLOCK_SIZE) : height;
+
+        for (int bx = 0; bx < width; bx += IMAGE_TRANSFORM_BLOCK_SIZE)
+        {
+            int bxEnd = ((bx + IMAGE_TRANSFORM_BLOCK_SIZE) < width)? (bx + IMAGE_TRANSFORM_BLOCK_SIZE) : width;
+
+            switch (bytesPerPixel)
+            {
+                case 1: TRANSFORM_BLOCK(unsigned char); break;
+                case 2: TRANSFORM_BLOCK(unsigned short); break;
+                case 4: TRANSFORM_BLOCK(unsigned int); break;
+                default:
+                {
+                    for (int y = by; y < byEnd; y++)
+                    {
+                        const unsigned char *srcPixel = src + (y*width + bx)*bytesPerPixel;
+                        unsigned char *dstPixel = dst + (origin + y*stepY + bx*stepX)*bytesPerPixel;
+
+                        for (int x = bx; x < bxEnd; x++, srcPixel += bytesPerPixel, dstPixel += stepX*bytesPerPixel)
+                        {
+                            for (int i = 0; i < bytesPerPixel; i++) dstPixel[i] = srcPixel[i];
+                        }
+                    }
+                } break;
+            }
+        }
+    }
+
+    #undef TRANSFORM_BLOCK
+}
+// Image dithering job: ordered dithering
+// NOTE: Every channel is quantized as (value*maxLevel + threshold)/255, with a threshold in [0..255)
+// taken from the mask pixel, a constant 127 threshold would be the nearest level
+static void DitherOrderedJob(void *data, int startRow, int endRow)
+{
+    // Bayer 8x8 matrix, pixels rank
+    static const unsigned char bayer[8][8] = {
+        {  0, 32,  8, 40,  2, 34, 10, 42 },
+        { 48, 16, 56, 24, 50, 18, 58, 26 },
+        { 12, 44,  4, 36, 14, 46,  6, 38 },
+        { 60, 28, 52, 20, 62, 30, 54, 22 },
+        {  3, 35, 11, 43,  1, 33,  9, 41 },
+        { 51, 19, 59, 27, 49, 17, 57, 25 },
+        { 15, 47,  7, 39, 13, 45,  5, 37 },
+        { 63, 31, 55, 23, 61, 29, 53, 21 }
+    };
+
+    DitherJobData *job = (DitherJobData *)data;
+    Color *buffer = (Color *)LoadImageScratch(job->width*sizeof(Color));
+
+    int maxLevels[4] = { (1 << job->bits[0]) - 1, (1 << job->bits[1]) - 1, (1 << job->bits[2]) - 1, (1 << job->bits[3]) - 1 };
+    int shifts[4] = { job->bits[1] + job->bits[2] + job->bits[3], job->bits[2] + job->bits[3], job->bits[3], 0 };
+    int maskSize = (job->method == DITHER_ORDERED_BLUE_NOISE)? DITHER_BLUE_NOISE_SIZE : 8;
+    int thresholds[(DITHER_BLUE_NOISE_SIZE > 8)? DITHER_BLUE_NOISE_SIZE : 8] = { 0 };
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        const Color *src = GetPixelRowColors(job->data + y*GetPixelDataSize(job->width, 1, job->format), job->width, job->format, buffer);
+        unsigned short *dst = job->pixels + y*job->width;
+
+        // Mask row thresholds, scaled to [0..255)
+        for (int i = 0; i < maskSize; i++)
+        {
+            if (job->method == DITHER_ORDERED_BLUE_NOISE) thresholds[i] = (2*ditherBlueNoise[(y%maskSize)*maskSize + i] + 1)*255/(2*maskSize*maskSize);
+            else thresholds[i] = (2*bayer[y%8][i] + 1)*255/128;
+        }
+
+        for (int x = 0; x < job->width; x++)
+        {
+            int threshold = thresholds[x%maskSize];
+            unsigned short pixel = (unsigned short)((((int)src[x].r*maxLevels[0] + threshold)/255) << shifts[0]);
+            pixel |= (unsigned short)((((int)src[x].g*maxLevels[1] + threshold)/255) << shifts[1]);
+            pixel |= (unsigned short)((((int)src[x].b*maxLevels[2] + threshold)/255) << shifts[2]);
+
+            if (job->bits[3] == 1) pixel |= (src[x].a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+            else if (job->bits[3] > 1) pixel |= (unsigned short)(((int)src[x].a*maxLevels[3] + threshold)/255);
+
+            dst[x] = pixel;
+        }
+    }
+
+    UnloadImageScratch(buffer);
+}
+
+// Image dithering: error diffusion (sequential)
+// NOTE: Rows are scanned in alternate directions (serpentine) to avoid directional artifacts,
+// errors are kept in 1/16 units and fully distributed (7/16, 3/16, 5/16, 1/16)
+static void DitherErrorDiffusion(DitherJobData *job)
+{
+    Color *buffer = (Color *)LoadImageScratch(job->width*sizeof(Color));
+
+    // Errors for current and next rows, one padding pixel on each side
+    int rowErrorsSize = (job->width + 2)*4;
+    int *errors = (int *)LoadImageScratch(2*rowErrorsSize*sizeof(int));
+    memset(errors, 0, 2*rowErrorsSize*sizeof(int));
+
+    int channels = (job->bits[3] > 1)? 4 : 3;     // 1 bit alpha is not dithered
+    int shifts[4] = { job->bits[1] + job->bits[2] + job->bits[3], job->bits[2] + job->bits[3], job->bits[3], 0 };
+
+    // Quantization lookup tables for every value (1/16 units): nearest level (shifted into pixel) and error
+    unsigned short *levels = (unsigned short *)LoadImageScratch(4*(255*16 + 1)*sizeof(unsigned short));
+    short *levelErrors = (short *)LoadImageScratch(4*(255*16 + 1)*sizeof(short));
+
+    for (int c = 0; c < channels; c++)
+    {
+        int maxLevel = (1 << job->bits[c]) - 1;
+
+        for (int v = 0; v <= 255*16; v++)
+        {
+            int level = (v*maxLevel + 255*8)/(255*16);
+
+            levels[c*(255*16 + 1) + v] = (unsigned short)(level << shifts[c]);
+            levelErrors[c*(255*16 + 1) + v] = (short)(v - (level*255*16 + maxLevel/2)/maxLevel);
+        }
+    }
+
+    for (int y = 0; y < job->height; y++)
+    {
+        const unsigned char *src = (const unsigned char *)GetPixelRowColors(job->data + y*GetPixelDataSize(job->width, 1, job->format), job->width, job->format, buffer);
+        unsigned short *dst = job->pixels + y*job->width;
+        int *current = errors + (y%2)*rowErrorsSize;
+        int *next = errors + ((y + 1)%2)*rowErrorsSize;
+        int step = ((y%2) == 0)? 4 : -4;
+        int x = ((y%2) == 0)? 0 : (job->width - 1);
+
+        // NOTE: Next row errors ahead of current pixel are set (not added) on first write
+        memset(next + (x + 1)*4 - step, 0, 4*sizeof(int));
+        memset(next + (x + 1)*4, 0, 4*sizeof(int));
+
+        for (int i = 0; i < job->width; i++, x += step/4)
+        {
+            int *pixelCurrent = current + (x + 1)*4;
+            int *pixelNext = next + (x + 1)*4;
+            unsigned short pixel = 0;
+
+            for (int c = 0; c < channels; c++)
+            {
+                int value = (int)src[x*4 + c]*16 + pixelCurrent[c];
+                if (value < 0) value = 0;
+                else if (value > 255*16) value = 255*16;
+
+                int error = levelErrors[c*(255*16 + 1) + value];
+                int error7 = error*7/16;
+                int error3 = error*3/16;
+                int error5 = error*5/16;
+
+                pixelCurrent[step + c] += error7;
+                pixelNext[-step + c] += error3;
+                pixelNext[c] += error5;
+                pixelNext[step + c] = error - error7 - error3 - error5;
+
+                pixel |= levels[c*(255*16 + 1) + value];
+            }
+
+            if (job->bits[3] == 1) pixel |= (src[x*4 + 3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+
+            dst[x] = pixel;
+        }
+    }
+
+    UnloadImageScratch(levelErrors);
+    UnloadImageScratch(levels);
+    UnloadImageScratch(errors);
+    UnloadImageScratch(buffer);
+}
+
+// Generate dithering blue noise mask (void-and-cluster)
+// NOTE: Pixels are ranked by repeatedly filling the largest void (lowest gaussian energy)
+// of a toroidal binary pattern, starting from a relaxed pattern of 1/10 pixels
+// NOTE: Called with worker data locked, no scratch buffers are used (they lock it too)
+// REF: Robert Ulichney, The void-and-cluster method for dither array generation, 1993
+static void GenDitherBlueNoise(void)
+{
+    const int size = DITHER_BLUE_NOISE_SIZE;
+    const int count = size*size;
+
+    bool *pattern = (bool *)RL_CALLOC(count, sizeof(bool));
+    float *energy = (float *)RL_CALLOC(count, sizeof(float));
+    float *kernel = (float *)RL_MALLOC(count*sizeof(float));
+
+    // Gaussian kernel (sigma = 1.5) over toroidal distances
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            int dx = (x < size/2)? x : (size - x);
+            int dy = (y < size/2)? y : (size - y);
+            kernel[y*size + x] = expf(-(float)(dx*dx + dy*dy)/(2.0f*1.5f*1.5f));
+        }
+    }
+
+    // Add or remove pattern pixel, updating energy; find tightest cluster or largest void
+    #define DITHER_UPDATE_ENERGY(index, sign) \
+        for (int ky = 0, py = (index)/size, px = (index)%size; ky < size; ky++) \
+            for (int kx = 0; kx < size; kx++) energy[ky*size + kx] += (sign)*kernel[((ky - py + size)%size)*size + (kx - px + size)%size]
+    #define DITHER_FIND_EXTREME(result, value, cluster) \
+        result = -1; \
+        for (int i = 0; i < count; i++) \
+            if ((pattern[i] == (value)) && ((result < 0) || ((cluster)? (energy[i] > energy[result]) : (energy[i] < energy[result])))) result = i
+
+    // Initial pattern: pseudo-random pixels (fixed seed, deterministic mask)
+    unsigned int seed = 0x2545f491;
+    int initialCount = count/10;
+
+    for (int n = 0; n < initialCount; )
+    {
+        seed = seed*1664525 + 1013904223;
+        int index = (int)((seed >> 8)%(unsigned int)count);
+
+        if (!pattern[index])
+        {
+            pattern[index] = true;
+            DITHER_UPDATE_ENERGY(index, 1.0f);
+            n++;
+        }
+    }
+
+    // Relax initial pattern: move tightest cluster pixel to largest void until it does not change
+    for (int iteration = 0; iteration < count; iteration++)
+    {
+        int cluster, hole;
+        DITHER_FIND_EXTREME(cluster, true, true);
+        pattern[cluster] = false;
+        DITHER_UPDATE_ENERGY(cluster, -1.0f);
+
+        DITHER_FIND_EXTREME(hole, false, false);
+        pattern[hole] = true;
+        DITHER_UPDATE_ENERGY(hole, 1.0f);
+
+        if (hole == cluster) break;
+    }
+
+    // Rank initial pattern pixels, removing tightest clusters first (highest ranks)
+    bool *initialPattern = (bool *)RL_MALLOC(count*sizeof(bool));
+    float *initialEnergy = (float *)RL_MALLOC(count*sizeof(float));
+    memcpy(initialPattern, pattern, count*sizeof(bool));
+    memcpy(initialEnergy, energy, count*sizeof(float));
+
+    for (int rank = initialCount - 1; rank >= 0; rank--)
+    {
+        int cluster;
+        DITHER_FIND_EXTREME(cluster, true, true);
+        pattern[cluster] = false;
+        DITHER_UPDATE_ENERGY(cluster, -1.0f);
+        ditherBlueNoise[cluster] = (unsigned short)rank;
+    }
+
+    // Rank remaining pixels, filling largest voids first (lowest ranks)
+    memcpy(pattern, initialPattern, count*sizeof(bool));
+    memcpy(energy, initialEnergy, count*sizeof(float));
+
+    for (int rank = initialCount; rank < count; rank++)
+    {
+        int hole;
+        DITHER_FIND_EXTREME(hole, false, false);
+        pattern[hole] = true;
+        DITHER_UPDATE_ENERGY(hole, 1.0f);
+        ditherBlueNoise[hole] = (unsigned short)rank;
+    }
+
+    #undef DITHER_UPDATE_ENERGY
+    #undef DITHER_FIND_EXTREME
+
+    RL_FREE(initialEnergy);
+    RL_FREE(initialPattern);
+    RL_FREE(kernel);
+    RL_FREE(energy);
+    RL_FREE(pattern);
+
+    ditherBlueNoiseReady = true;
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+// Compute Adler-32 checksum (zlib stream)
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size)
+{
+    unsigned int s1 = adler & 0xffff;
+    unsigned int s2 = adler >> 16;
+
+    while (size > 0)
+    {
+        int blockSize = (size < 5552)? size : 5552;     // Max bytes processed before s2 could overflow
+
+        for (int i = 0; i < blockSize; i++)
+        {
+            s1 += data[i];
+            s2 += s1;
+        }
+
+        s1 %= 65521;
+        s2 %= 65521;
+        data += blockSize;
+        size -= blockSize;
+    }
+
+    return (s2 << 16) | s1;
+}
+
+// Combine Adler-32 checksums of two consecutive data blocks, second block size required
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2)
+{
+    unsigned int rem = (unsigned int)size2%65521;
+    unsigned int s1 = adler1 & 0xffff;
+    unsigned int s2 = (rem*s1)%65521;
+
+    s1 += (adler2 & 0xffff) + 65521 - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + 65521 - rem;
+
+    if (s1 >= 65521) s1 -= 65521;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s2 >= 2*65521) s2 -= 2*65521;
+    if (s2 >= 65521) s2 -= 65521;
+
+    return (s2 << 16) | s1;
+}
+
+// Filter PNG row data (filter type: 0-None, 1-Sub, 2-Up, 3-Average, 4-Paeth)
+// NOTE: Branchless inner loops, vectorized by the compiler on optimized builds
+static void FilterPngRow(unsigned char *output, const unsigned char *row, const unsigned char *prevRow, int size, int bpp, int filter)
+{
+    switch (filter)
+    {
+        case 0: memcpy(output, row, size); break;
+        case 1:
+        {
+            for (int i = 0; i < bpp; i++) output[i] = row[i];
+            for (int i = bpp; i < size; i++) output[i] = row[i] - row[i - bpp];
+        } break;
+        case 2:
+        {
+            for (int i = 0; i < size; i++) output[i] = row[i] - prevRow[i];
+        } break;
+        case 3:
+        {
+            for (int i = 0; i < bpp; i++) output[i] = row[i] - (prevRow[i] >> 1);
+            for (int i = bpp; i < size; i++) output[i] = row[i] - ((row[i - bpp] + prevRow[i]) >> 1);
+        } break;
+        case 4:
+        {
+            // NOTE: Paeth predictor for first pixel is always the up value
+            for (int i = 0; i < bpp; i++) output[i] = row[i] - prevRow[i];
+            for (int i = bpp; i < size; i++)
+            {
+                int a = row[i - bpp];
+                int b = prevRow[i];
+                int c = prevRow[i - bpp];
+                int pa = abs(b - c);
+                int pb = abs(a - c);
+                int pc = abs(a + b - 2*c);
+                int predictor = ((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c);
+
+                output[i] = row[i] - predictor;
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Get PNG filtered row cost, sum of absolute values (as signed bytes)
+// NOTE: Usual heuristic to choose the row filter that compresses best
+static unsigned int GetPngRowCost(const unsigned char *data, int size)
+{
+    unsigned int cost = 0;
+
+    for (int i = 0; i < size; i++) cost += abs((signed char)data[i]);
+
+    return cost;
+}
+
+// PNG encoding job: filter a range of rows
+static void EncodePngFilterJob(void *data, int startRow, int endRow)
+{
+    EncodePngJobData *job = (EncodePngJobData *)data;
+    int lineSize = job->width*job->channels;
+
+    // Buffer for previous row of first row (zeros) and all filters candidates
+    unsigned char *buffer = (unsigned char *)LoadImageScratch(6*lineSize);
+    if (buffer == NULL)
+    {
+        LockWorkerData();
+        job->failed = true;
+        UnlockWorkerData();
+        return;
+    }
+    memset(buffer, 0, 6*lineSize);
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        const unsigned char *row = job->pixels + (size_t)y*lineSize;
+        const unsigned char *prevRow = (y > 0)? (row - lineSize) : buffer;
+        unsigned char *output = job->filtered + (size_t)y*job->rowSize;
+
+        if (job->level == PNG_COMPRESSION_FAST)
+        {
+            // Fast preset uses fixed filter: Up (Sub for first row)
+            output[0] = (y > 0)? 2 : 1;
+            FilterPngRow(output + 1, row, prevRow, lineSize, job->channels, output[0]);
+        }
+        else
+        {
+            int bestFilter = 0;
+            unsigned int bestCost = 0;
+
+            for (int filter = 0; filter < 5; filter++)
+            {
+                unsigned char *candidate = buffer + (1 + filter)*lineSize;
+                FilterPngRow(candidate, row, prevRow, lineSize, job->channels, filter);
+
+                unsigned int cost = GetPngRowCost(candidate, lineSize);
+
+                if ((filter == 0) || (cost < bestCost))
+                {
+                    bestFilter = filter;
+                    bestCost = cost;
+                }
+            }
+
+            output[0] = (unsigned char)bestFilter;
+            memcpy(output + 1, buffer + (1 + bestFilter)*lineSize, lineSize);
+        }
+    }
+
+    UnloadImageScratch(buffer);
+}
+
+// PNG encoding job: compress a range of filtered data parts, every part is stored as an IDAT chunk
+// NOTE: Previous part data is used as preset dictionary, first part includes zlib stream header
+static void EncodePngDeflateJob(void *data, int start, int end)
+{
+    EncodePngJobData *job = (EncodePngJobData *)data;
+    int partSize = job->rowsPerPart*job->rowSize;
+    int totalSize = job->height*job->rowSize;
+
+    struct sdefl *sdefl = (struct sdefl *)LoadImageScratch(sizeof(struct sdefl));
+    if (sdefl == NULL)
+    {
+        LockWorkerData();
+        job->failed = true;
+        UnlockWorkerData();
+        return;
+    }
+    memset(sdefl, 0, sizeof(struct sdefl));
+
+    for (int i = start; i < end; i++)
+    {
+        int offset = i*partSize;
+        int size = ((totalSize - offset) < partSize)? (totalSize - offset) : partSize;
+        int dictSize = (offset < SDEFL_WIN_SIZ)? offset : SDEFL_WIN_SIZ;
+        int headerSize = (i == 0)? 2 : 0;
+
+        // NOTE: Space required for chunk length, type and CRC, plus part sync flush marker
+        unsigned char *chunk = (unsigned char *)LoadImageScratch(12 + headerSize + sdefl_bound(size) + 8);
+        if (chunk == NULL)
+        {
+            LockWorkerData();
+            job->failed = true;
+            UnlockWorkerData();
+            break;
+        }
+
+        unsigned char *compData = chunk + 8;
+        if (i == 0)
+        {
+            compData[0] = 0x78;     // zlib header: deflate, 32K window
+            compData[1] = 0x01;     // zlib header: fast compression, no dictionary
+        }
+
+        int compSize = headerSize + rl_sdeflate_part(sdefl, compData + headerSize, job->filtered + offset, dictSize, size, job->level, (i == (job->partCount - 1)));
+
+        WriteUInt32BE(chunk, (unsigned int)compSize);
+        memcpy(chunk + 4, "IDAT", 4);
+        WriteUInt32BE(chunk + 8 + compSize, stbiw__crc32(chunk + 4, compSize + 4));
+
+        job->parts[i] = chunk;
+        job->partSizes[i] = 12 + compSize;
+        job->partChecksums[i] = ComputeAdler32(1, job->filtered + offset, size);
+    }
+
+    UnloadImageScratch(sdefl);
+}
+
+// Encode image pixels as PNG file data, 8 bit per channel (1 to 4 channels)
+// NOTE: Rows are filtered and compressed in parallel, data parts compressed independently
+// are joined in a single zlib stream, compression ratio is barely affected
+static unsigned char *EncodeImagePng(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize)
+{
+    static const unsigned char pngSignature[8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+    static const unsigned char pngColorType[5] = { 0, 0, 4, 2, 6 };     // PNG color type by channels count
+
+    unsigned char *fileData = NULL;
+    *dataSize = 0;
+
+    if ((pixels == NULL) || (width <= 0) || (height <= 0) || (channels < 1) || (channels > 4)) return NULL;
+
+    EncodePngJobData job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.channels = channels;
+    job.level = (level < SDEFL_LVL_MIN)? SDEFL_LVL_MIN : ((level > SDEFL_LVL_MAX)? SDEFL_LVL_MAX : level);
+    job.rowSize = width*channels + 1;
+    job.rowsPerPart = (PNG_EXPORT_PART_SIZE/job.rowSize > 0)? PNG_EXPORT_PART_SIZE/job.rowSize : 1;
+    job.partCount = (height + job.rowsPerPart - 1)/job.rowsPerPart;
+    job.filtered = (unsigned char *)LoadImageScratch(job.rowSize*height);
+    job.parts = (unsigned char **)RL_CALLOC(job.partCount, sizeof(unsigned char *));
+    job.partSizes = (int *)RL_CALLOC(job.partCount, sizeof(int));
+    job.partChecksums = (unsigned int *)RL_CALLOC(job.partCount, sizeof(unsigned int));
+
+    if ((job.filtered != NULL) && (job.parts != NULL) && (job.partSizes != NULL) && (job.partChecksums != NULL))
+    {
+        // NOTE: Filtered data is not compressed if any filter job failed, incomplete rows
+        RunWorkerJobs(EncodePngFilterJob, &job, height, 1 + PNG_EXPORT_PART_SIZE/(4*job.rowSize));
+        if (!job.failed) RunWorkerJobs(EncodePngDeflateJob, &job, job.partCount, 1);
+
+        // Get file size and zlib stream checksum, all parts must be compressed
+        int fileSize = 8 + 25 + 16 + 12;    // Signature, IHDR, IDAT (checksum), IEND
+        unsigned int checksum = job.partChecksums[0];
+
+        for (int i = 0; i < job.partCount; i++)
+        {
+            if (job.failed || (job.parts[i] == NULL)) { fileSize = 0; break; }
+
+            fileSize += job.partSizes[i];
+
+            // NOTE: Only last part data size could be smaller than rowsPerPart rows
+            int partRows = ((height - i*job.rowsPerPart) < job.rowsPerPart)? (height - i*job.rowsPerPart) : job.rowsPerPart;
+            if (i > 0) checksum = CombineAdler32(checksum, job.partChecksums[i], partRows*job.rowSize);
+        }
+
+        if (fileSize > 0) fileData = (unsigned char *)RL_MALLOC(fileSize);
+
+        if (fileData != NULL)
+        {
+            unsigned char *ptr = fileData;
+
+            memcpy(ptr, pngSignature, 8);
+            ptr += 8;
+
+            // IHDR chunk: size, bit depth, color type, compression, filter and interlace methods
+            WriteUInt32BE(ptr, 13);
+            memcpy(ptr + 4, "IHDR", 4);
+            WriteUInt32BE(ptr + 8, (unsigned int)width);
+            WriteUInt32BE(ptr + 12, (unsigned int)height);
+            ptr[16] = 8;
+            ptr[17] = pngColorType[channels];
+            ptr[18] = 0;
+            ptr[19] = 0;
+            ptr[20] = 0;
+            WriteUInt32BE(ptr + 21, stbiw__crc32(ptr + 4, 17));
+            ptr += 25;
+
+            // IDAT chunks: compressed parts, zlib stream checksum
+            for (int i = 0; i < job.partCount; i++)
+            {
+                memcpy(ptr, job.parts[i], job.partSizes[i]);
+                ptr += job.partSizes[i];
+            }
+
+            WriteUInt32BE(ptr, 4);
+            memcpy(ptr + 4, "IDAT", 4);
+            WriteUInt32BE(ptr + 8, checksum);
+            WriteUInt32BE(ptr + 12, stbiw__crc32(ptr + 4, 8));
+            ptr += 16;
+
+            // IEND chunk
+            WriteUInt32BE(ptr, 0);
+            memcpy(ptr + 4, "IEND", 4);
+            WriteUInt32BE(ptr + 8, stbiw__crc32(ptr + 4, 4));
+
+            *dataSize = fileSize;
+        }
+
+        for (int i = job.partCount - 1; i >= 0; i--) UnloadImageScratch(job.parts[i]);
+    }
+
+    UnloadImageScratch(job.filtered);
+    RL_FREE(job.parts);
+    RL_FREE(job.partSizes);
+    RL_FREE(job.partChecksums);
+
+    return fileData;
+}
+#endif
+
+#if defined(SUPPORT_TEXTURE_IMPORT_CACHE)
+// Compute import cache hash for file data (FNV-1a 64-bit)
+static unsigned long long ComputeImportHash(const unsigned char *data, unsigned int dataSize)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+
+    for (unsigned int i = 0; i < dataSize; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Apply import processing to image: premultiply, power-of-two, format and mipmaps (in that order)
+static void ProcessImportImage(Image *image, int format, unsigned int flags)
+{
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if (flags & TEXTURE_IMPORT_PREMULTIPLY) ImageAlphaPremultiply(image);
+#endif
+    if (flags & TEXTURE_IMPORT_POT) ImageToPOT(image, BLANK);
+    if (format != 0) ImageFormat(image, format);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if (flags & TEXTURE_IMPORT_MIPMAPS) ImageMipmaps(image);
+#else
+    if (flags & (TEXTURE_IMPORT_PREMULTIPLY | TEXTURE_IMPORT_MIPMAPS)) TRACELOG(LOG_WARNING, "IMAGE: Import processing requires SUPPORT_IMAGE_MANIPULATION");
+#endif
+}
+
+// Compute import cache stamp for file: path, size and modification time (FNV-1a 64-bit)
+// NOTE: Returns 0 if not available (file not found or custom file loader set), content hash is required
+static unsigned long long ComputeImportStamp(const char *fileName)
+{
+    unsigned long long stamp = 0;
+
+    if (!IsLoadFileDataCallbackSet())
+    {
+        int fileSize = GetFileLength(fileName);
+        long modTime = GetFileModTime(fileName);
+
+        if ((fileSize > 0) && (modTime > 0))
+        {
+            char key[MAX_FILEPATH_LENGTH + 64] = { 0 };
+            int keyLength = snprintf(key, sizeof(key), "%s|%i|%li", fileName, fileSize, modTime);
+
+            if (keyLength >= (int)sizeof(key)) keyLength = (int)sizeof(key) - 1;
+            stamp = ComputeImportHash((const unsigned char *)key, (unsigned int)keyLength);
+        }
+    }
+
+    return stamp;
+}
+
+// Load image from import cache file, image is loaded only if required (image != NULL)
+static bool LoadImportCacheFile(const char *cacheFileName, Image *image)
+{
+    bool success = false;
+
+    if (FileExists(cacheFileName))
+    {
+        if (image == NULL) success = true;
+        else
+        {
+            unsigned int cacheSize = 0;
+            unsigned char *cacheData = LoadFileData(cacheFileName, &cacheSize);
+
+            if (cacheData != NULL)
+            {
+                image->data = rl_load_ktx_from_memory(cacheData, cacheSize, &image->width, &image->height, &image->format, &image->mipmaps);
+                RL_FREE(cacheData);
+
+                if ((image->data != NULL) && (image->format != 0)) success = true;
+                else
+                {
+                    RL_FREE(image->data);
+                    *image = (Image){ 0 };
+                    TRACELOG(LOG_WARNING, "IMAGE: [%s] Import cache file not valid, importing again", cacheFileName);
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+// Get unique temporary file name for an import cache file (same directory, renamed once written)
+// NOTE: Name is unique between threads (counter) and processes (time and module address)
+static void GetImportTempFileName(const char *fileName, char *tempFileName, int size)
+{
+    static unsigned int tempCounter = 0;
+
+    LockWorkerData();
+    unsigned int counter = tempCounter++;
+    UnlockWorkerData();
+
+    unsigned long long key = ((unsigned long long)time(NULL) << 32) ^ (unsigned long long)(size_t)&tempCounter;
+    snprintf(tempFileName, size, "%s.%016llx_%u.tmp", fileName, ComputeImportHash((const unsigned char *)&key, sizeof(key)), counter);
+}
+
+// Move temporary file into import cache (rename), temporary file is removed on failure
+// NOTE: Concurrent imports of same source save same content, if rename fails because
+// file already exists (not replaced on some platforms), existing file is kept
+static bool CommitImportCacheFile(const char *tempFileName, const char *fileName)
+{
+    bool success = (rename(tempFileName, fileName) == 0);
+
+    if (!success)
+    {
+        remove(tempFileName);
+        success = FileExists(fileName);
+    }
+
+    return success;
+}
+
+// Import image file through import cache, image is loaded only if required (image != NULL)
+// NOTE: Cache is looked up by file path, size and modification time first (.ref file), source file
+// is only loaded and hashed on a miss; safe to be called from worker threads
+static bool ImportImageFile(const char *fileName, int format, unsigned int flags, Image *image)
+{
+    bool success = false;
+    bool useCache = (textureImportCachePath[0] != '\0');
+    char cacheFileName[MAX_FILEPATH_LENGTH + 64] = { 0 };   // Cache directory + hash file name
+    char refFileName[MAX_FILEPATH_LENGTH + 64] = { 0 };     // Cache directory + stamp file name
+    unsigned long long stamp = useCache? ComputeImportStamp(fileName) : 0;
+
+    // Fast path: stamp reference file stores content hash and file size, source file is not read
+    if (stamp != 0)
+    {
+        snprintf(refFileName, sizeof(refFileName), "%s/%016llx.ref", textureImportCachePath, stamp);
+
+        // NOTE: Reference file written in same second source file was modified is not trusted,
+        // file could have been modified again in that second keeping size and modification time
+        if (FileExists(refFileName) && (GetFileModTime(refFileName) > GetFileModTime(fileName)))
+        {
+            char *refText = LoadFileText(refFileName);
+            unsigned long long hash = 0;
+            int fileSize = 0;
+
+            if ((refText != NULL) && (sscanf(refText, "%16llx %i", &hash, &fileSize) == 2) && (fileSize == GetFileLength(fileName)))
+            {
+                snprintf(cacheFileName, sizeof(cacheFileName), "%s/%016llx_%02i_%02x.ktx", textureImportCachePath, hash, format, flags);
+                success = LoadImportCacheFile(cacheFileName, image);
+            }
+
+            UnloadFileText(refText);
+        }
+    }
+
+    if (!success)
+    {
+        unsigned int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL)
+        {
+            unsigned long long hash = 0;
+
+            if (useCache)
+            {
+                hash = ComputeImportHash(fileData, dataSize);
+                snprintf(cacheFileName, sizeof(cacheFileName), "%s/%016llx_%02i_%02x.ktx", textureImportCachePath, hash, format, flags);
+                success = LoadImportCacheFile(cacheFileName, image);
+            }
+
+            if (!success)
+            {
+                Image imported = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+
+                if (imported.data != NULL)
+                {
+                    ProcessImportImage(&imported, format, flags);
+                    success = true;
+
+                    if (useCache)
+                    {
+                        // Cache file saved to a temporary file first, cache never serves a partially written file
+                        char tempFileName[MAX_FILEPATH_LENGTH + 96] = { 0 };
+                        GetImportTempFileName(cacheFileName, tempFileName, sizeof(tempFileName));
+
+                        if (!rl_save_ktx(tempFileName, imported.data, imported.width, imported.height, imported.format, imported.mipmaps) ||
+                            !CommitImportCacheFile(tempFileName, cacheFileName))
+                        {
+                            TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to save import cache file", cacheFileName);
+                        }
+                    }
+
+                    if (image != NULL) *image = imported;
+                    else UnloadImage(imported);
+                }
+            }
+
+            // Map file stamp to content hash, next lookups skip source file loading and hashing
+            if (success && (stamp != 0))
+            {
+                char hashText[48] = { 0 };
+                char tempFileName[MAX_FILEPATH_LENGTH + 96] = { 0 };
+
+                snprintf(hashText, sizeof(hashText), "%016llx %u", hash, dataSize);
+                GetImportTempFileName(refFileName, tempFileName, sizeof(tempFileName));
+                if (SaveFileText(tempFileName, hashText)) CommitImportCacheFile(tempFileName, refFileName);
+            }
+
+            RL_FREE(fileData);
+        }
+    }
+
+    return success;
+}
+
+// Import directory job: import a range of files into import cache
+static void ImportImageJob(void *data, int start, int end)
+{
+    ImportImageJobData *job = (ImportImageJobData *)data;
+
+    for (int i = start; i < end; i++) job->results[i] = ImportImageFile(job->files.paths[i], job->format, job->flags, NULL);
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Image generation job: vertical gradient
+static void GenImageGradientVJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+    Color top = job->col1;
+    Color bottom = job->col2;
+
+    for (int j = startRow; j < endRow; j++)
+    {
+        float factor = (float)j/(float)job->height;
+
+        Color color = {
+            (unsigned char)((float)bottom.r*factor + (float)top.r*(1.f - factor)),
+            (unsigned char)((float)bottom.g*factor + (float)top.g*(1.f - factor)),
+            (unsigned char)((float)bottom.b*factor + (float)top.b*(1.f - factor)),
+            (unsigned char)((float)bottom.a*factor + (float)top.a*(1.f - factor))
+        };
+
+        // NOTE: Vertical gradient color is constant along the row
+        Color *row = job->pixels + j*job->width;
+        for (int i = 0; i < job->width; i++) row[i] = color;
+    }
+}
+
+// Image generation job: horizontal gradient
+static void GenImageGradientHJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+    Color left = job->col1;
+    Color right = job->col2;
+
+    // NOTE: Horizontal gradient is the same for all rows, first row of the band is computed
+    // and then copied to the following rows
+    Color *first = job->pixels + startRow*job->width;
+
+    for (int i = 0; i < job->width; i++)
+    {
+        float factor = (float)i/(float)job->width;
+
+        first[i].r = (unsigned char)((float)right.r*factor + (float)left.r*(1.f - factor));
+        first[i].g = (unsigned char)((float)right.g*factor + (float)left.g*(1.f - factor));
+        first[i].b = (unsigned char)((float)right.b*factor + (float)left.b*(1.f - factor));
+        first[i].a = (unsigned char)((float)right.a*factor + (float)left.a*(1.f - factor));
+    }
+
+    for (int j = startRow + 1; j < endRow; j++) memcpy(job->pixels + j*job->width, first, job->width*sizeof(Color));
+}
+
+// Image generation job: radial gradient
+static void GenImageGradientRadialJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+    Color inner = job->col1;
+    Color outer = job->col2;
+    float density = job->factor;
+
+    float radius = (job->width < job->height)? (float)job->width/2.0f : (float)job->height/2.0f;
+    float centerX = (float)job->width/2.0f;
+    float centerY = (float)job->height/2.0f;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        for (int x = 0; x < job->width; x++)
+        {
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (float)fmax(factor, 0.0f);
+            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+
+            Color *pixel = &job->pixels[y*job->width + x];
+            pixel->r = (unsigned char)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixel->g = (unsigned char)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixel->b = (unsigned char)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixel->a = (unsigned char)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Image generation job: checked
+static void GenImageCheckedJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        Color *row = job->pixels + y*job->width;
+        int checkY = y/job->tileSizeY;
+
+        for (int x = 0; x < job->width; x++)
+        {
+            if ((x/job->tileSizeX + checkY)%2 == 0) row[x] = job->col1;
+            else row[x] = job->col2;
+        }
+    }
+}
+
+// Image generation job: white noise
+static void GenImageWhiteNoiseJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+    unsigned int threshold = (unsigned int)(job->factor*100.0f);
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        for (int x = 0; x < job->width; x++)
+        {
+            // Integer hash of pixel index and seed (lowbias32), stateless and thread-safe
+            unsigned int h = (unsigned int)(y*job->width + x) ^ job->seed;
+            h ^= h >> 16;
+            h *= 0x7feb352dU;
+            h ^= h >> 15;
+            h *= 0x846ca68bU;
+            h ^= h >> 16;
+
+            job->pixels[y*job->width + x] = ((h%100) < threshold)? WHITE : BLACK;
+        }
+    }
+}
+
+// Image generation job: perlin noise
+static void GenImagePerlinNoiseJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        for (int x = 0; x < job->width; x++)
+        {
+            float nx = (float)(x + job->offsetX)*job->scale/(float)job->width;
+            float ny = (float)(y + job->offsetY)*job->scale/(float)job->height;
+
+            // NOTE: We need to translate the data from [-1..1] to [0..1]
+            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, job->lacunarity, job->gain, job->octaves) + 1.0f)/2.0f;
+
+            // Clamp between 0.0f and 1.0f, fbm output can go out of range
+            if (p < 0.0f) p = 0.0f;
+            else if (p > 1.0f) p = 1.0f;
+
+            unsigned char intensity = (unsigned char)(p*255.0f);
+            job->pixels[y*job->width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Image generation job: seeded fractal noise
+static void GenImageFractalNoiseJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+
+    // NOTE: stb_perlin seed selects one permutation (8 bits), next seed bits select the noise plane
+    int seed = (int)(job->seed & 0xff);
+    float z = (float)((job->seed >> 8) & 0xff) + 0.5f;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        for (int x = 0; x < job->width; x++)
+        {
+            float nx = (float)(x + job->offsetX)*job->scale/(float)job->width;
+            float ny = (float)(y + job->offsetY)*job->scale/(float)job->height;
+
+            float frequency = 1.0f;
+            float amplitude = 1.0f;
+            float sum = 0.0f;
+            float range = 0.0f;
+
+            for (int i = 0; i < job->octaves; i++)
+            {
+                sum += stb_perlin_noise3_seed(nx*frequency, ny*frequency, z, 0, 0, 0, seed + i)*amplitude;
+                range += amplitude;
+                frequency *= job->lacunarity;
+                amplitude *= job->gain;
+            }
+
+            // NOTE: We need to translate the data from [-range..range] to [0..1]
+            float p = (sum/range + 1.0f)/2.0f;
+
+            if (p < 0.0f) p = 0.0f;
+            else if (p > 1.0f) p = 1.0f;
+
+            unsigned char intensity = (unsigned char)(p*255.0f);
+            job->pixels[y*job->width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Image generation job: cellular
+static void GenImageCellularJob(void *data, int startRow, int endRow)
+{
+    GenImageJobData *job = (GenImageJobData *)data;
+    int tileSize = job->tileSizeX;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < job->width; x++)
+        {
+            int tileX = x/tileSize;
+
+            int minDistanceSqr = 0x7fffffff;
+
+            // Check all adjacent tiles, squared distances are compared and only closest one is square-rooted
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= job->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= job->seedsPerCol)) continue;
+
+                    Vector2 neighborSeed = job->seeds[(tileY + j)*job->seedsPerRow + tileX + i];
+
+                    int dx = x - (int)neighborSeed.x;
+                    int dy = y - (int)neighborSeed.y;
+                    int distSqr = dx*dx + dy*dy;
+
+                    if (distSqr < minDistanceSqr) minDistanceSqr = distSqr;
+                }
+            }
+
+            float minDistance = (minDistanceSqr < 0x7fffffff)? sqrtf((float)minDistanceSqr) : 65536.0f;
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            job->pixels[y*job->width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+// Get color formatted as pixel data, returns bytes per pixel (0 if not supported)
+// NOTE: Pixel conversion is the same one applied by ImageDrawPixel(), pixel must fit 16 bytes
+static int GetImagePixelData(Color color, int format, unsigned char *pixel)
+{
+    if ((format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return 0;
+
+    Image pixelImage = { pixel, 1, 1, 1, format };
+    ImageDrawPixel(&pixelImage, 0, 0, color);
+
+    return GetPixelDataSize(1, 1, format);
+}
+
+// Fill clipped horizontal span [startX, endX) with pixel data
+static void ImageFillSpan(Image *dst, int startX, int endX, int y, const unsigned char *pixel, int bytesPerPixel)
+{
+    if ((y < 0) || (y >= dst->height)) return;
+    if (startX < 0) startX = 0;
+    if (endX > dst->width) endX = dst->width;
+    if (startX >= endX) return;
+
+    int count = endX - startX;
+    unsigned char *span = (unsigned char *)dst->data + ((size_t)y*dst->width + startX)*bytesPerPixel;
+
+    switch (bytesPerPixel)
+    {
+        case 1: memset(span, pixel[0], count); break;
+        case 2:
+        {
+            unsigned short value = 0;
+            memcpy(&value, pixel, 2);
+            for (int i = 0; i < count; i++) ((unsigned short *)span)[i] = value;
+        } break;
+        case 4:
+        {
+            unsigned int value = 0;
+            memcpy(&value, pixel, 4);
+            for (int i = 0; i < count; i++) ((unsigned int *)span)[i] = value;
+        } break;
+        default:
+        {
+            // Copy first pixel, then keep doubling the already filled data
+            int size = count*bytesPerPixel;
+            int filled = bytesPerPixel;
+            memcpy(span, pixel, bytesPerPixel);
+
+            while (filled < size)
+            {
+                int copySize = ((size - filled) < filled)? (size - filled) : filled;
+                memcpy(span + filled, span, copySize);
+                filled += copySize;
+            }
+        } break;
+    }
+}
+
+// Alpha-blend color into clipped horizontal span [startX, endX)
+// NOTE: Blending is the same one applied by ImageDraw(), opaque colors are filled directly
+static void ImageBlendSpan(Image *dst, int startX, int endX, int y, Color color)
+{
+    if (color.a == 0) return;
+
+    if (color.a == 255)
+    {
+        unsigned char pixel[16] = { 0 };
+        int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+        if (bytesPerPixel > 0) ImageFillSpan(dst, startX, endX, y, pixel, bytesPerPixel);
+        return;
+    }
+
+    if ((y < 0) || (y >= dst->height)) return;
+    if (startX < 0) startX = 0;
+    if (endX > dst->width) endX = dst->width;
+    if (startX >= endX) return;
+
+    if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        Color *span = (Color *)dst->data + (size_t)y*dst->width;
+
+        for (int x = startX; x < endX; x++) span[x] = ColorAlphaBlend(span[x], color, WHITE);
+    }
+    else if (dst->format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        // Span pixels blended by chunks, converted back to pixel format once per chunk
+        int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+        unsigned char *span = (unsigned char *)dst->data + (size_t)y*dst->width*bytesPerPixel;
+        Color colors[64] = { 0 };
+
+        for (int x = startX; x < endX; x += 64)
+        {
+            int count = ((endX - x) < 64)? (endX - x) : 64;
+            unsigned char *pixels = span + x*bytesPerPixel;
+
+            for (int i = 0; i < count; i++) colors[i] = ColorAlphaBlend(GetPixelColor(pixels + i*bytesPerPixel, dst->format), color, WHITE);
+            SetPixelDataColors(pixels, count, dst->format, colors);
+        }
+    }
+}
+
+// Fill polygon by scanlines, sampling at pixel centers (even-odd rule)
+static void ImageFillPolygon(Image *dst, Vector2 *points, int pointCount, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetImagePixelData(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
+    // Get polygon vertical bounds, clipped to image
+    float minY = points[0].y;
+    float maxY = points[0].y;
+
+    for (int i = 1; i < pointCount; i++)
+    {
+        if (points[i].y < minY) minY = points[i].y;
+        if (points[i].y > maxY) maxY = points[i].y;
+    }
+
+    int startY = (int)ceilf(minY - 0.5f);
+    int endY = (int)ceilf(maxY - 0.5f);
+    if (startY < 0) startY = 0;
+    if (endY > dst->height) endY = dst->height;
+    if (startY >= endY) return;
+
+    // Every scanline crosses at most pointCount edges
+    float stackCrossings[16] = { 0 };
+    float *crossings = (pointCount <= 16)? stackCrossings : (float *)RL_MALLOC(pointCount*sizeof(float));
+
+    for (int y = startY; y < endY; y++)
+    {
+        float scanY = (float)y + 0.5f;
+        int crossingCount = 0;
+
+        // Find edges crossings with scanline, half-open on Y so shared vertices are counted once
+        for (int i = 0, j = pointCount - 1; i < pointCount; j = i++)
+        {
+            Vector2 a = points[j];
+            Vector2 b = points[i];
+
+            if (((a.y <= scanY) && (b.y > scanY)) || ((b.y <= scanY) && (a.y > scanY)))
+            {
+                float x = a.x + (scanY - a.y)*(b.x - a.x)/(b.y - a.y);
+
+                // Insertion sort, crossings count is usually small
+                int k = crossingCount++;
+                while ((k > 0) && (crossings[k - 1] > x)) { crossings[k] = crossings[k - 1]; k--; }
+                crossings[k] = x;
+            }
+        }
+
+        // Fill pixels with center between every pair of crossings
+        for (int k = 0; k + 1 < crossingCount; k += 2)
+        {
+            ImageFillSpan(dst, (int)ceilf(crossings[k] - 0.5f), (int)ceilf(crossings[k + 1] - 0.5f), y, pixel, bytesPerPixel);
+        }
+    }
+
+    if (crossings != stackCrossings) RL_FREE(crossings);
+}
+
+// Get rectangle clipped to texture bounds, in whole pixels
+static Rectangle GetTextureClippedRec(Texture2D texture, Rectangle rec)
+{
+    int x = (int)rec.x;
+    int y = (int)rec.y;
+    int endX = x + (int)rec.width;
+    int endY = y + (int)rec.height;
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (endX > texture.width) endX = texture.width;
+    if (endY > texture.height) endY = texture.height;
+
+    if ((endX <= x) || (endY <= y)) return (Rectangle){ 0 };
+
+    return (Rectangle){ (float)x, (float)y, (float)(endX - x), (float)(endY - y) };
 }
 
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -8,6 +8,11 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_WORKER_THREADS
+*       Allow some heavy processing functions to split their work across multiple threads
+*       NOTE: Threads are not available on PLATFORM_WEB, work is always processed on calling thread
+*       NOTE: Also enables a background worker thread to process queued tasks in order (FIFO)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -50,12 +55,59 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_WORKER_THREADS) && !defined(PLATFORM_WEB)
+    #define WORKER_THREADS_AVAILABLE
+    #if defined(_WIN32)
+        // Declare required functions to avoid including windows.h (conflicts with raylib symbols)
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **cond, void **lock, unsigned long milliseconds, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **cond);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     128     // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS            4     // Max number of threads used to process jobs (including calling thread)
+#endif
+#ifndef MAX_WORKER_TASKS
+    #define MAX_WORKER_TASKS              8     // Max number of tasks queued for background worker thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Worker job, a contiguous range of items to be processed
+typedef struct WorkerJob {
+    WorkerJobCallback callback;     // Job processing function
+    void *userData;                 // Job user data, shared by all jobs
+    int start;                      // Range first item
+    int end;                        // Range last item (exclusive)
+} WorkerJob;
+
+// Worker items, handed one at a time to threads as they finish previous ones
+typedef struct WorkerItems {
+    WorkerJobCallback callback;     // Item processing function
+    void *userData;                 // Items user data
+    int count;                      // Items count
+    int next;                       // Next item to be processed, protected by itemLock
+} WorkerItems;
+
+// Worker task, processed by background worker thread
+typedef struct WorkerTask {
+    WorkerTaskCallback callback;    // Task processing function
+    void *userData;                 // Task user data
+} WorkerTask;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -68,6 +120,27 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(WORKER_THREADS_AVAILABLE)
+// Background worker tasks queue (ring buffer), protected by taskLock
+static WorkerTask taskQueue[MAX_WORKER_TASKS] = { 0 };
+static int taskQueueHead = 0;                       // Next task to be processed
+static int taskQueueCount = 0;                      // Tasks queued, including task being processed
+static bool taskThreadRunning = false;              // Background worker thread running
+#if defined(_WIN32)
+static void *itemLock = NULL;                       // Worker items lock (SRWLOCK_INIT)
+static void *dataLock = NULL;                       // Worker shared data lock (SRWLOCK_INIT)
+static void *taskLock = NULL;                       // Tasks queue lock (SRWLOCK_INIT)
+static void *taskCondition = NULL;                  // Tasks queue condition (CONDITION_VARIABLE_INIT)
+static void *taskThread = NULL;                     // Background worker thread handle
+#else
+static pthread_mutex_t itemLock = PTHREAD_MUTEX_INITIALIZER;    // Worker items lock
+static pthread_mutex_t dataLock = PTHREAD_MUTEX_INITIALIZER;    // Worker shared data lock
+static pthread_mutex_t taskLock = PTHREAD_MUTEX_INITIALIZER;    // Tasks queue lock
+static pthread_cond_t taskCondition = PTHREAD_COND_INITIALIZER; // Tasks queue condition, signaled on any queue change
+static pthread_t taskThread;                        // Background worker thread
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -77,6 +150,10 @@ void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = cal
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
 
+// Check if custom file data loader is set
+// NOTE: Used by modules streaming data directly from files, file data must be loaded with LoadFileData() instead
+bool IsLoadFileDataCallbackSet(void) { return (loadFileData != NULL); }
+
 
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
@@ -86,6 +163,22 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThread(void *arg);     // Worker thread entry point, process one job
+static unsigned long __stdcall WorkerTaskThread(void *arg); // Background worker thread entry point, process queued tasks
+#else
+static void *WorkerThread(void *arg);                       // Worker thread entry point, process one job
+static void *WorkerTaskThread(void *arg);                   // Background worker thread entry point, process queued tasks
+#endif
+static void WorkerItemsJob(void *data, int start, int end);  // Worker items job, process items until none is left
+static int GetNextWorkerItem(WorkerItems *items);           // Get next worker item to be processed, -1 if none is left
+static void LockWorkerTasks(void);                          // Lock tasks queue
+static void UnlockWorkerTasks(void);                        // Unlock tasks queue
+static void WaitWorkerTasksCondition(void);                 // Wait for tasks queue change (tasks queue must be locked)
+static void SignalWorkerTasksCondition(void);               // Signal tasks queue change
+#endif
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -407,6 +500,195 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Get number of threads used to process worker jobs (including calling thread)
+int GetWorkerThreadCount(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    return (MAX_WORKER_THREADS > 1)? MAX_WORKER_THREADS : 1;
+#else
+    return 1;
+#endif
+}
+
+// Run worker jobs over items range [0..count), waits until all jobs are finished
+// NOTE: Range is split in contiguous chunks of at least minChunkSize items, one chunk per thread,
+// first chunk is always processed by the calling thread, callback must only write to its own range
+void RunWorkerJobs(WorkerJobCallback callback, void *userData, int count, int minChunkSize)
+{
+    if ((callback == NULL) || (count <= 0)) return;
+    if (minChunkSize < 1) minChunkSize = 1;
+
+    int jobCount = (count + minChunkSize - 1)/minChunkSize;
+    if (jobCount > GetWorkerThreadCount()) jobCount = GetWorkerThreadCount();
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (jobCount > 1)
+    {
+        WorkerJob jobs[MAX_WORKER_THREADS] = { 0 };
+    #if defined(_WIN32)
+        void *threads[MAX_WORKER_THREADS] = { 0 };
+    #else
+        pthread_t threads[MAX_WORKER_THREADS] = { 0 };
+    #endif
+        bool launched[MAX_WORKER_THREADS] = { 0 };
+
+        for (int i = 0; i < jobCount; i++)
+        {
+            jobs[i].callback = callback;
+            jobs[i].userData = userData;
+            jobs[i].start = (int)(((long long)count*i)/jobCount);
+            jobs[i].end = (int)(((long long)count*(i + 1))/jobCount);
+        }
+
+        for (int i = 1; i < jobCount; i++)
+        {
+        #if defined(_WIN32)
+            threads[i] = CreateThread(NULL, 0, WorkerThread, &jobs[i], 0, NULL);
+            launched[i] = (threads[i] != NULL);
+        #else
+            launched[i] = (pthread_create(&threads[i], NULL, WorkerThread, &jobs[i]) == 0);
+        #endif
+            // NOTE: If the thread could not be created, job is processed by calling thread
+            if (!launched[i]) TRACELOG(LOG_WARNING, "THREAD: Failed to create worker thread, processing job on calling thread");
+        }
+
+        callback(userData, jobs[0].start, jobs[0].end);
+
+        for (int i = 1; i < jobCount; i++)
+        {
+            if (launched[i])
+            {
+            #if defined(_WIN32)
+                WaitForSingleObject(threads[i], 0xFFFFFFFF);    // INFINITE
+                CloseHandle(threads[i]);
+            #else
+                pthread_join(threads[i], NULL);
+            #endif
+            }
+            else callback(userData, jobs[i].start, jobs[i].end);
+        }
+
+        return;
+    }
+#endif
+
+    callback(userData, 0, count);
+}
+
+// Run worker jobs over items range [0..count) one item at a time, waits until all items are processed
+// NOTE: Items are handed to threads as they finish the previous ones, so items with different costs
+// are balanced between threads; at most maxThreads items are processed at once (0 uses all threads)
+void RunWorkerItems(WorkerJobCallback callback, void *userData, int count, int maxThreads)
+{
+    if ((callback == NULL) || (count <= 0)) return;
+    if ((maxThreads <= 0) || (maxThreads > GetWorkerThreadCount())) maxThreads = GetWorkerThreadCount();
+    if (maxThreads > count) maxThreads = count;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (maxThreads > 1)
+    {
+        WorkerItems items = { callback, userData, count, 0 };
+
+        // NOTE: Every job processes items until none is left, one job per thread
+        RunWorkerJobs(WorkerItemsJob, &items, maxThreads, 1);
+
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) callback(userData, i, i + 1);
+}
+
+// Lock data shared between calling thread and worker threads
+// NOTE: Lock is not recursive, keep it only for short data updates
+void LockWorkerData(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&dataLock);
+    #else
+    pthread_mutex_lock(&dataLock);
+    #endif
+#endif
+}
+
+// Unlock data shared between calling thread and worker threads
+void UnlockWorkerData(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&dataLock);
+    #else
+    pthread_mutex_unlock(&dataLock);
+    #endif
+#endif
+}
+
+// Queue task to be processed by background worker thread, tasks are processed in order (FIFO)
+// NOTE: If queue is full, waits until one task is finished, if threads are not available,
+// task is processed by calling thread before returning
+void QueueWorkerTask(WorkerTaskCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    LockWorkerTasks();
+
+    while (taskQueueCount == MAX_WORKER_TASKS) WaitWorkerTasksCondition();
+
+    if (!taskThreadRunning)
+    {
+    #if defined(_WIN32)
+        taskThread = CreateThread(NULL, 0, WorkerTaskThread, NULL, 0, NULL);
+        taskThreadRunning = (taskThread != NULL);
+    #else
+        taskThreadRunning = (pthread_create(&taskThread, NULL, WorkerTaskThread, NULL) == 0);
+    #endif
+    }
+
+    if (taskThreadRunning)
+    {
+        taskQueue[(taskQueueHead + taskQueueCount)%MAX_WORKER_TASKS] = (WorkerTask){ callback, userData };
+        taskQueueCount++;
+
+        SignalWorkerTasksCondition();
+        UnlockWorkerTasks();
+        return;
+    }
+
+    UnlockWorkerTasks();
+
+    // NOTE: Previous tasks are always finished at this point (no thread running)
+    TRACELOG(LOG_WARNING, "THREAD: Failed to create background worker thread, processing task on calling thread");
+#endif
+
+    callback(userData);
+}
+
+// Wait until all queued tasks are finished, background worker thread is closed
+void WaitWorkerTasks(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    LockWorkerTasks();
+
+    bool running = taskThreadRunning;
+    taskThreadRunning = false;      // Request thread to finish once queue is empty
+
+    SignalWorkerTasksCondition();
+    UnlockWorkerTasks();
+
+    if (running)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(taskThread, 0xFFFFFFFF);    // INFINITE
+        CloseHandle(taskThread);
+    #else
+        pthread_join(taskThread, NULL);
+    #endif
+    }
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -453,6 +735,131 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker thread entry point, process one job
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThread(void *arg)
+#else
+static void *WorkerThread(void *arg)
+#endif
+{
+    WorkerJob *job = (WorkerJob *)arg;
+    job->callback(job->userData, job->start, job->end);
+
+    return 0;
+}
+
+// Background worker thread entry point, process queued tasks until queue is empty and thread is closed
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerTaskThread(void *arg)
+#else
+static void *WorkerTaskThread(void *arg)
+#endif
+{
+    (void)arg;
+
+    LockWorkerTasks();
+
+    while (true)
+    {
+        if (taskQueueCount > 0)
+        {
+            WorkerTask task = taskQueue[taskQueueHead];
+
+            // NOTE: Task is kept in queue count while processed, so WaitWorkerTasks() waits for it
+            UnlockWorkerTasks();
+            task.callback(task.userData);
+            LockWorkerTasks();
+
+            taskQueueHead = (taskQueueHead + 1)%MAX_WORKER_TASKS;
+            taskQueueCount--;
+
+            SignalWorkerTasksCondition();
+        }
+        else if (!taskThreadRunning) break;
+        else WaitWorkerTasksCondition();
+    }
+
+    UnlockWorkerTasks();
+
+    return 0;
+}
+
+// Worker items job, process items until none is left
+// NOTE: Job range is not used, every job takes next items from shared items counter
+static void WorkerItemsJob(void *data, int start, int end)
+{
+    (void)start;
+    (void)end;
+
+    WorkerItems *items = (WorkerItems *)data;
+
+    for (int i = GetNextWorkerItem(items); i >= 0; i = GetNextWorkerItem(items)) items->callback(items->userData, i, i + 1);
+}
+
+// Get next worker item to be processed, -1 if none is left
+static int GetNextWorkerItem(WorkerItems *items)
+{
+    int item = -1;
+
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&itemLock);
+#else
+    pthread_mutex_lock(&itemLock);
+#endif
+
+    if (items->next < items->count) item = items->next++;
+
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&itemLock);
+#else
+    pthread_mutex_unlock(&itemLock);
+#endif
+
+    return item;
+}
+
+// Lock tasks queue
+static void LockWorkerTasks(void)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&taskLock);
+#else
+    pthread_mutex_lock(&taskLock);
+#endif
+}
+
+// Unlock tasks queue
+static void UnlockWorkerTasks(void)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&taskLock);
+#else
+    pthread_mutex_unlock(&taskLock);
+#endif
+}
+
+// Wait for tasks queue change (tasks queue must be locked)
+static void WaitWorkerTasksCondition(void)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&taskCondition, &taskLock, 0xFFFFFFFF, 0);    // INFINITE
+#else
+    pthread_cond_wait(&taskCondition, &taskLock);
+#endif
+}
+
+// Signal tasks queue change
+static void SignalWorkerTasksCondition(void)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(&taskCondition);
+#else
+    pthread_cond_broadcast(&taskCondition);
+#endif
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *buf, int size)
 {
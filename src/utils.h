@@ -45,6 +45,18 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Thread local storage for internal static buffers (functions returning static strings)
+// NOTE: Every thread gets its own buffers, returned strings are safe to use from worker threads
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define RL_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define RL_THREAD_LOCAL _Thread_local
+#else
+    #define RL_THREAD_LOCAL
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -55,7 +67,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Worker job callback, processes items range [start..end)
+typedef void (*WorkerJobCallback)(void *userData, int start, int end);
+
+// Worker task callback, processes one task on background worker thread
+typedef void (*WorkerTaskCallback)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +85,16 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+int GetWorkerThreadCount(void);                                         // Get number of threads used to process worker jobs
+void RunWorkerJobs(WorkerJobCallback callback, void *userData, int count, int minChunkSize);    // Run worker jobs over items range [0..count), blocking
+void RunWorkerItems(WorkerJobCallback callback, void *userData, int count, int maxThreads);      // Run worker jobs over items range [0..count) one item at a time (dynamic), blocking
+void LockWorkerData(void);                                              // Lock data shared with worker threads (not recursive)
+void UnlockWorkerData(void);                                            // Unlock data shared with worker threads
+void QueueWorkerTask(WorkerTaskCallback callback, void *userData);      // Queue task on background worker thread (FIFO), waits if queue is full
+void WaitWorkerTasks(void);                                             // Wait until all queued tasks are finished
+
+bool IsLoadFileDataCallbackSet(void);                                   // Check if custom file data loader is set (files must be loaded with LoadFileData())
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!